@@ -63,7 +63,7 @@ static void stderr_print_strn(void *env, const char *str, size_t len) {
     (void)dummy;
 }
 
-static const mp_print_t mp_stderr_print = {NULL, stderr_print_strn};
+const mp_print_t mp_stderr_print = {NULL, stderr_print_strn};
 
 static int compile_and_save(const char *file, const char *output_file, const char *source_file) {
     nlr_buf_t nlr;
@@ -138,6 +138,8 @@ static int usage(char **argv) {
     printf(
         #if MICROPY_EMIT_NATIVE
         "  emit={bytecode,native,viper} -- set the default code emitter\n"
+        "  emit=native-all -- emit native code for each function that supports it, reporting\n"
+        "    the functions that stay as bytecode\n"
         #else
         "  emit=bytecode -- set the default code emitter\n"
         #endif
@@ -170,6 +172,8 @@ static void pre_process_options(int argc, char **argv) {
                     emit_opt = MP_EMIT_OPT_NATIVE_PYTHON;
                 } else if (strcmp(argv[a + 1], "emit=viper") == 0) {
                     emit_opt = MP_EMIT_OPT_VIPER;
+                } else if (strcmp(argv[a + 1], "emit=native-all") == 0) {
+                    emit_opt = MP_EMIT_OPT_NATIVE_ALL;
                 #endif
                 } else if (strncmp(argv[a + 1], "heapsize=", sizeof("heapsize=") - 1) == 0) {
                     char *end;
@@ -350,6 +354,14 @@ MP_NOINLINE int main_(int argc, char **argv) {
         exit(1);
     }
 
+    #if MICROPY_EMIT_NATIVE
+    if (emit_opt != MP_EMIT_OPT_NONE && emit_opt != MP_EMIT_OPT_BYTECODE
+        && mp_dynamic_compiler.native_arch == MP_NATIVE_ARCH_NONE) {
+        mp_printf(&mp_stderr_print, "native code emitter requires -march\n");
+        exit(1);
+    }
+    #endif
+
     int ret = compile_and_save(input_file, output_file, source_file);
 
     #if MICROPY_PY_MICROPYTHON_MEM_INFO
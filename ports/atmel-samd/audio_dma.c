@@ -408,7 +408,7 @@ void audio_dma_evsys_handler(void) {
             continue;
         }
 
-        background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+        background_callback_add_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_PRIORITY_HIGH);
     }
 }
 
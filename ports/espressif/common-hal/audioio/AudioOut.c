@@ -429,7 +429,7 @@ static bool IRAM_ATTR handle_convert_done(dac_continuous_handle_t handle, const
 
     self->put_buffer_index = new_put_buf_idx;
 
-    background_callback_add(&self->callback, audioout_buf_callback_fun, user_data);
+    background_callback_add_priority(&self->callback, audioout_buf_callback_fun, user_data, BACKGROUND_CALLBACK_PRIORITY_HIGH);
 
     return false;
 }
@@ -50,6 +50,7 @@ void common_hal_paralleldisplaybus_parallelbus_construct_nonsequential(paralleld
     self->config.clk_src = LCD_CLK_SRC_DEFAULT;
     self->config.bus_width = n_pins;
     self->config.max_transfer_bytes = 512;
+    self->transfer_done = true;
     for (uint8_t i = 0; i < n_pins; i++) {
         self->config.data_gpio_nums[i] = common_hal_mcu_pin_number(data_pins[i]);
     }
@@ -176,13 +177,8 @@ void common_hal_paralleldisplaybus_parallelbus_send(mp_obj_t obj, display_byte_t
         return;
     }
     if (byte_type == DISPLAY_DATA) {
-        // We don't use the color transmit function because this buffer will be small-ish. displayio
-        // will already partition it into small pieces.
-        self->transfer_done = false;
-        CHECK_ESP_RESULT(esp_lcd_panel_io_tx_color(self->panel_io_handle, -1, data, data_length));
-        while (!self->transfer_done) {
-            RUN_BACKGROUND_TASKS;
-        }
+        common_hal_paralleldisplaybus_parallelbus_send_nonblocking(obj, data, data_length);
+        common_hal_paralleldisplaybus_parallelbus_wait_for_send(obj);
     } else if (data_length == 1) {
         CHECK_ESP_RESULT(esp_lcd_panel_io_tx_param(self->panel_io_handle, data[0], NULL, 0));
     } else {
@@ -190,6 +186,24 @@ void common_hal_paralleldisplaybus_parallelbus_send(mp_obj_t obj, display_byte_t
     }
 }
 
+void common_hal_paralleldisplaybus_parallelbus_send_nonblocking(mp_obj_t obj, const uint8_t *data, uint32_t data_length) {
+    paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    if (data_length == 0) {
+        return;
+    }
+    // We don't use the color transmit function because this buffer will be small-ish. displayio
+    // will already partition it into small pieces.
+    self->transfer_done = false;
+    CHECK_ESP_RESULT(esp_lcd_panel_io_tx_color(self->panel_io_handle, -1, data, data_length));
+}
+
+void common_hal_paralleldisplaybus_parallelbus_wait_for_send(mp_obj_t obj) {
+    paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    while (!self->transfer_done) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
 void common_hal_paralleldisplaybus_parallelbus_end_transaction(mp_obj_t obj) {
     paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
     gpio_set_level(self->cs_pin_number, true);
@@ -68,6 +68,7 @@ CIRCUITPY_MAX3421E ?= 1
 CIRCUITPY_MEMORYMAP ?= 1
 CIRCUITPY_NVM ?= 1
 CIRCUITPY_PARALLELDISPLAYBUS ?= 1
+CIRCUITPY_PARALLELDISPLAYBUS_NONBLOCKING ?= 1
 CIRCUITPY_PS2IO ?= 1
 CIRCUITPY_RGBMATRIX ?= 1
 CIRCUITPY_ROTARYIO ?= 1
@@ -484,7 +484,7 @@ void __not_in_flash_func(isr_dma_0)(void) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
             // Record all channels whose DMA has completed; they need loading.
             dma->channels_to_load_mask |= mask;
-            background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+            background_callback_add_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_PRIORITY_HIGH);
         }
         if (MP_STATE_PORT(background_pio_read)[i] != NULL) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio_read)[i];
@@ -75,6 +75,9 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
         mp_raise_ValueError(MP_ERROR_TEXT("SPI peripheral in use"));
     }
 
+    self->dma_tx = -1;
+    self->dma_rx = -1;
+
     self->target_frequency = 250000;
     self->real_frequency = spi_init(self->peripheral, self->target_frequency);
 
@@ -111,6 +114,7 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
     if (common_hal_busio_spi_deinited(self)) {
         return;
     }
+    common_hal_busio_spi_wait_for_write(self);
     never_reset_spi[spi_get_index(self->peripheral)] = false;
     spi_deinit(self->peripheral);
 
@@ -169,57 +173,82 @@ void common_hal_busio_spi_unlock(busio_spi_obj_t *self) {
     self->has_lock = false;
 }
 
-static bool _transfer(busio_spi_obj_t *self,
+// Starts a DMA transfer and returns true, unless the transfer is short or two DMA channels
+// aren't free. Call _finish_dma before touching the buffers.
+static bool _start_dma(busio_spi_obj_t *self,
     const uint8_t *data_out, size_t out_len,
     uint8_t *data_in, size_t in_len) {
     // Use DMA for large transfers if channels are available
     const size_t dma_min_size_threshold = 32;
-    int chan_tx = -1;
-    int chan_rx = -1;
     size_t len = MAX(out_len, in_len);
-    if (len >= dma_min_size_threshold) {
-        // Use two DMA channels to service the two FIFOs
-        chan_tx = dma_claim_unused_channel(false);
-        chan_rx = dma_claim_unused_channel(false);
+    if (len < dma_min_size_threshold) {
+        return false;
     }
-    bool use_dma = chan_rx >= 0 && chan_tx >= 0;
-    if (use_dma) {
-        dma_channel_config c = dma_channel_get_default_config(chan_tx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
-        channel_config_set_read_increment(&c, out_len == len);
-        channel_config_set_write_increment(&c, false);
-        dma_channel_configure(chan_tx, &c,
-            &spi_get_hw(self->peripheral)->dr,
-            data_out,
-            len,
-            false);
-
-        c = dma_channel_get_default_config(chan_rx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
-        channel_config_set_read_increment(&c, false);
-        channel_config_set_write_increment(&c, in_len == len);
-        dma_channel_configure(chan_rx, &c,
-            data_in,
-            &spi_get_hw(self->peripheral)->dr,
-            len,
-            false);
-
-        dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
-        while (dma_channel_is_busy(chan_rx) || dma_channel_is_busy(chan_tx)) {
-            // TODO: We should idle here until we get a DMA interrupt or something else.
-            RUN_BACKGROUND_TASKS;
+    // Use two DMA channels to service the two FIFOs
+    int chan_tx = dma_claim_unused_channel(false);
+    int chan_rx = dma_claim_unused_channel(false);
+    if (chan_rx < 0 || chan_tx < 0) {
+        // If we have claimed only one channel successfully, we should release immediately.
+        if (chan_rx >= 0) {
+            dma_channel_unclaim(chan_rx);
+        }
+        if (chan_tx >= 0) {
+            dma_channel_unclaim(chan_tx);
         }
+        return false;
     }
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+    channel_config_set_read_increment(&c, out_len == len);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(chan_tx, &c,
+        &spi_get_hw(self->peripheral)->dr,
+        data_out,
+        len,
+        false);
+
+    c = dma_channel_get_default_config(chan_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, in_len == len);
+    dma_channel_configure(chan_rx, &c,
+        data_in,
+        &spi_get_hw(self->peripheral)->dr,
+        len,
+        false);
+
+    self->dma_tx = chan_tx;
+    self->dma_rx = chan_rx;
+    dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+    return true;
+}
 
-    // If we have claimed only one channel successfully, we should release immediately. This also
-    // releases the DMA after use_dma has been done.
-    if (chan_rx >= 0) {
-        dma_channel_unclaim(chan_rx);
+// Waits for the transfer started by _start_dma, if there is one, and releases its channels.
+static void _finish_dma(busio_spi_obj_t *self) {
+    if (self->dma_tx < 0) {
+        return;
     }
-    if (chan_tx >= 0) {
-        dma_channel_unclaim(chan_tx);
+    while (dma_channel_is_busy(self->dma_rx) || dma_channel_is_busy(self->dma_tx)) {
+        // TODO: We should idle here until we get a DMA interrupt or something else.
+        RUN_BACKGROUND_TASKS;
+    }
+    dma_channel_unclaim(self->dma_rx);
+    dma_channel_unclaim(self->dma_tx);
+    self->dma_tx = -1;
+    self->dma_rx = -1;
+}
+
+static bool _transfer(busio_spi_obj_t *self,
+    const uint8_t *data_out, size_t out_len,
+    uint8_t *data_in, size_t in_len) {
+    // Let a write started by common_hal_busio_spi_write_nonblocking finish first.
+    _finish_dma(self);
+    size_t len = MAX(out_len, in_len);
+    bool use_dma = _start_dma(self, data_out, out_len, data_in, in_len);
+    if (use_dma) {
+        _finish_dma(self);
     }
 
     if (!use_dma) {
@@ -259,6 +288,19 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     return _transfer(self, data, len, (uint8_t *)&data_in, MIN(len, 4));
 }
 
+bool common_hal_busio_spi_write_nonblocking(busio_spi_obj_t *self,
+    const uint8_t *data, size_t len) {
+    _finish_dma(self);
+    if (_start_dma(self, data, len, (uint8_t *)&self->dma_rx_sink, MIN(len, 4))) {
+        return true;
+    }
+    return _transfer(self, data, len, (uint8_t *)&self->dma_rx_sink, MIN(len, 4));
+}
+
+void common_hal_busio_spi_wait_for_write(busio_spi_obj_t *self) {
+    _finish_dma(self);
+}
+
 bool common_hal_busio_spi_read(busio_spi_obj_t *self,
     uint8_t *data, size_t len, uint8_t write_value) {
     uint32_t data_out = write_value << 24 | write_value << 16 | write_value << 8 | write_value;
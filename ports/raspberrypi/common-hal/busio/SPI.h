@@ -24,6 +24,11 @@ typedef struct {
     uint8_t polarity;
     uint8_t phase;
     uint8_t bits;
+    // DMA channels of a transfer that is still going, or -1.
+    int8_t dma_tx;
+    int8_t dma_rx;
+    // Where a write puts the bytes it reads back.
+    uint32_t dma_rx_sink;
 } busio_spi_obj_t;
 
 void reset_spi(void);
@@ -1,3 +1,4 @@
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -17,6 +18,19 @@
 #include "py/stream.h"
 #include "py/binary.h"
 #include "py/bc.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/RefreshStats.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#include "shared-bindings/framebufferio/FramebufferDisplay.h"
+#include "shared-bindings/vectorio/Circle.h"
+#include "shared-bindings/vectorio/Polygon.h"
+#include "shared-bindings/vectorio/Rectangle.h"
+#include "shared-bindings/vectorio/VectorShape.h"
+#include "shared-module/displayio/area.h"
+#include "supervisor/background_callback.h"
+#include "supervisor/port.h"
 
 // expected output of this file is found in extra_coverage.py.exp
 
@@ -182,6 +196,94 @@ static void pairheap_test(size_t nops, int *ops) {
     mp_printf(&mp_plat_print, "\n");
 }
 
+// supervisor/shared/background_callback.c calls this before running callbacks.
+void port_background_task(void) {
+}
+
+static void print_refresh_areas(const displayio_area_t *area) {
+    mp_printf(&mp_plat_print, "areas:");
+    for (; area != NULL; area = area->next) {
+        mp_printf(&mp_plat_print, " (%d,%d)-(%d,%d)", area->x1, area->y1, area->x2, area->y2);
+    }
+    mp_printf(&mp_plat_print, "\n");
+}
+
+static void bgcb_print(void *data) {
+    mp_printf(&mp_plat_print, " %s", (const char *)data);
+}
+
+static background_callback_t bgcb_late;
+
+static void bgcb_print_and_queue(void *data) {
+    bgcb_print(data);
+    background_callback_add_priority(&bgcb_late, bgcb_print, "late-high", BACKGROUND_CALLBACK_PRIORITY_HIGH);
+}
+
+static void bgcb_run_all(void) {
+    mp_printf(&mp_plat_print, "run:");
+    background_callback_run_all();
+    mp_printf(&mp_plat_print, "\n");
+}
+
+// Each producer thread queues its own callbacks over and over while the main
+// thread runs them.  A callback must run at least once after each add.
+#define BGCB_THREADS (4)
+#define BGCB_PER_THREAD (8)
+#define BGCB_ITERATIONS (50000)
+
+typedef struct {
+    background_callback_t cb;
+    uint32_t adds;
+    uint32_t seen;
+} bgcb_stress_t;
+
+static bgcb_stress_t bgcb_stress[BGCB_THREADS][BGCB_PER_THREAD];
+static int bgcb_producers;
+
+static void bgcb_stress_fun(void *data) {
+    bgcb_stress_t *s = data;
+    s->seen = __atomic_load_n(&s->adds, __ATOMIC_SEQ_CST);
+}
+
+static void *bgcb_stress_thread(void *arg) {
+    bgcb_stress_t *s = arg;
+    for (int i = 0; i < BGCB_ITERATIONS; ++i) {
+        bgcb_stress_t *t = &s[(i * 5) % BGCB_PER_THREAD];
+        __atomic_add_fetch(&t->adds, 1, __ATOMIC_SEQ_CST);
+        background_callback_add_priority(&t->cb, bgcb_stress_fun, t, i % BACKGROUND_CALLBACK_NUM_PRIORITIES);
+    }
+    __atomic_sub_fetch(&bgcb_producers, 1, __ATOMIC_SEQ_CST);
+    return NULL;
+}
+
+static void bgcb_stress_test(void) {
+    pthread_t threads[BGCB_THREADS];
+    bgcb_producers = BGCB_THREADS;
+    for (int i = 0; i < BGCB_THREADS; ++i) {
+        pthread_create(&threads[i], NULL, bgcb_stress_thread, bgcb_stress[i]);
+    }
+    while (__atomic_load_n(&bgcb_producers, __ATOMIC_SEQ_CST) > 0) {
+        background_callback_run_all();
+    }
+    for (int i = 0; i < BGCB_THREADS; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    background_callback_run_all();
+
+    int lost = 0, queued = 0;
+    uint32_t runs = 0;
+    for (int i = 0; i < BGCB_THREADS; ++i) {
+        for (int j = 0; j < BGCB_PER_THREAD; ++j) {
+            bgcb_stress_t *t = &bgcb_stress[i][j];
+            lost += t->seen != t->adds;
+            queued += background_callback_queued(&t->cb);
+            runs += t->cb.run_count;
+        }
+    }
+    mp_printf(&mp_plat_print, "stress: lost %d queued %d pending %d ran %d\n",
+        lost, queued, background_callback_pending(), runs > 0 && runs <= BGCB_THREADS * BGCB_ITERATIONS);
+}
+
 // function to run extra tests for things that can't be checked by scripts
 static mp_obj_t extra_coverage(void) {
     // mp_printf (used by ports that don't have a native printf)
@@ -729,6 +831,383 @@ static mp_obj_t extra_coverage(void) {
         mp_printf(&mp_plat_print, "%d %d\n", mp_obj_is_int(MP_OBJ_NEW_SMALL_INT(1)), mp_obj_is_int(mp_obj_new_int_from_ll(1)));
     }
 
+    // background callbacks
+    {
+        mp_printf(&mp_plat_print, "# background callbacks\n");
+        static background_callback_t cb[6];
+
+        // Priority classes run high to low, each in the order queued.
+        background_callback_add_priority(&cb[0], bgcb_print, "low1", BACKGROUND_CALLBACK_PRIORITY_LOW);
+        background_callback_add(&cb[1], bgcb_print, "normal1");
+        background_callback_add_priority(&cb[2], bgcb_print, "high1", BACKGROUND_CALLBACK_PRIORITY_HIGH);
+        background_callback_add_priority(&cb[3], bgcb_print, "low2", BACKGROUND_CALLBACK_PRIORITY_LOW);
+        background_callback_add(&cb[4], bgcb_print, "normal2");
+        background_callback_add_priority(&cb[5], bgcb_print, "high2", BACKGROUND_CALLBACK_PRIORITY_HIGH);
+        mp_printf(&mp_plat_print, "%d %d\n", background_callback_pending(), background_callback_queued(&cb[0]));
+        bgcb_run_all();
+        mp_printf(&mp_plat_print, "%d %d %u\n", background_callback_pending(), background_callback_queued(&cb[0]), (uint)cb[0].run_count);
+
+        // Queueing a queued callback does nothing.
+        background_callback_add(&cb[1], bgcb_print, "normal1");
+        background_callback_add(&cb[1], bgcb_print, "normal1");
+        bgcb_run_all();
+
+        // High priority callbacks queued while a batch runs go next.
+        background_callback_add(&cb[1], bgcb_print_and_queue, "normal1");
+        background_callback_add(&cb[4], bgcb_print, "normal2");
+        bgcb_run_all();
+
+        // Running can be prevented.
+        background_callback_prevent();
+        background_callback_add(&cb[1], bgcb_print, "normal1");
+        bgcb_run_all();
+        background_callback_allow();
+        bgcb_run_all();
+
+        // Reset drops callbacks on the heap.
+        background_callback_t *heap_cb = m_new0(background_callback_t, 1);
+        background_callback_add(heap_cb, bgcb_print, "heap");
+        background_callback_add(&cb[1], bgcb_print, "static");
+        background_callback_reset();
+        mp_printf(&mp_plat_print, "%d %d\n", background_callback_queued(heap_cb), background_callback_queued(&cb[1]));
+        bgcb_run_all();
+
+        bgcb_stress_test();
+    }
+
+    // displayio dirty areas
+    {
+        mp_printf(&mp_plat_print, "# displayio dirty areas\n");
+        displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+        common_hal_displayio_bitmap_construct(bitmap, 100, 100, 8);
+        print_refresh_areas(displayio_bitmap_get_refresh_areas(bitmap, NULL));
+        displayio_bitmap_finish_refresh(bitmap);
+
+        // Far apart changes stay separate and nearby ones merge.
+        common_hal_displayio_bitmap_set_pixel(bitmap, 0, 0, 1);
+        common_hal_displayio_bitmap_set_pixel(bitmap, 99, 99, 1);
+        common_hal_displayio_bitmap_set_pixel(bitmap, 1, 0, 1);
+        common_hal_displayio_bitmap_set_pixel(bitmap, 98, 99, 1);
+        print_refresh_areas(displayio_bitmap_get_refresh_areas(bitmap, NULL));
+        displayio_bitmap_finish_refresh(bitmap);
+
+        // Past the limit the cheapest areas merge.
+        for (int i = 0; i < CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT + 1; i++) {
+            common_hal_displayio_bitmap_set_pixel(bitmap, i * 20, i * 20, 1);
+        }
+        print_refresh_areas(displayio_bitmap_get_refresh_areas(bitmap, NULL));
+        displayio_bitmap_finish_refresh(bitmap);
+
+        // Areas are clipped to the bitmap and ones inside others are absorbed.
+        displayio_area_t area = {-10, -10, 30, 30, NULL};
+        displayio_bitmap_set_dirty_area(bitmap, &area);
+        area = (displayio_area_t) {5, 5, 10, 10, NULL};
+        displayio_bitmap_set_dirty_area(bitmap, &area);
+        area = (displayio_area_t) {200, 200, 300, 300, NULL};
+        displayio_bitmap_set_dirty_area(bitmap, &area);
+        print_refresh_areas(displayio_bitmap_get_refresh_areas(bitmap, NULL));
+    }
+
+    // displayio palette native colors
+    {
+        mp_printf(&mp_plat_print, "# displayio palette native colors\n");
+        displayio_palette_t *palette = mp_obj_malloc(displayio_palette_t, &displayio_palette_type);
+        common_hal_displayio_palette_construct(palette, 2, false);
+        common_hal_displayio_palette_set_color(palette, 0, 0xff0000);
+        common_hal_displayio_palette_set_color(palette, 1, 0xffffff);
+        _displayio_colorspace_t colorspace = {.depth = 16};
+        const uint32_t *native = displayio_palette_get_native_colors(palette, &colorspace);
+        mp_printf(&mp_plat_print, "%04x %04x\n", (uint)native[0], (uint)native[1]);
+
+        // Changing a color or the grayscale settings rebuilds the table.
+        common_hal_displayio_palette_set_color(palette, 0, 0x0000ff);
+        native = displayio_palette_get_native_colors(palette, &colorspace);
+        mp_printf(&mp_plat_print, "%04x %04x\n", (uint)native[0], (uint)native[1]);
+        colorspace = (_displayio_colorspace_t) {.depth = 4, .grayscale = true, .grayscale_bit = 4};
+        native = displayio_palette_get_native_colors(palette, &colorspace);
+        mp_printf(&mp_plat_print, "%x %x\n", (uint)native[0], (uint)native[1]);
+
+        // Indices past the end and transparent colors aren't opaque.
+        mp_printf(&mp_plat_print, "opaque %d %d\n", displayio_palette_is_opaque(palette, 2), displayio_palette_is_opaque(palette, 4));
+        common_hal_displayio_palette_make_transparent(palette, 1);
+        mp_printf(&mp_plat_print, "opaque %d\n", displayio_palette_is_opaque(palette, 2));
+        for (uint32_t i = 0; i < 3; i++) {
+            displayio_input_pixel_t input_pixel = {.pixel = i};
+            displayio_output_pixel_t output_pixel = {.pixel = 0, .opaque = true};
+            displayio_palette_get_color(palette, &colorspace, &input_pixel, &output_pixel);
+            mp_printf(&mp_plat_print, "%d:%x ", output_pixel.opaque, (uint)output_pixel.pixel);
+        }
+        mp_printf(&mp_plat_print, "\n");
+
+        // Palettes defined statically without a table convert one color at a time.
+        static _displayio_color_t static_colors[2] = {{.rgb888 = 0x000000, .transparent = true}, {.rgb888 = 0x00ff00}};
+        static displayio_palette_t static_palette = {
+            .base = {.type = &displayio_palette_type },
+            .colors = static_colors,
+            .color_count = 2,
+            .transparent_count = 1,
+        };
+        colorspace = (_displayio_colorspace_t) {.depth = 16};
+        mp_printf(&mp_plat_print, "table %d\n", displayio_palette_get_native_colors(&static_palette, &colorspace) != NULL);
+        for (uint32_t i = 0; i < 2; i++) {
+            displayio_input_pixel_t input_pixel = {.pixel = i};
+            displayio_output_pixel_t output_pixel = {.pixel = 0, .opaque = true};
+            displayio_palette_get_color(&static_palette, &colorspace, &input_pixel, &output_pixel);
+            mp_printf(&mp_plat_print, "%d:%04x ", output_pixel.opaque, (uint)output_pixel.pixel);
+        }
+        mp_printf(&mp_plat_print, "\n");
+    }
+
+    // displayio refresh stats
+    {
+        mp_printf(&mp_plat_print, "# displayio refresh stats\n");
+        displayio_refreshstats_t *stats = mp_obj_malloc(displayio_refreshstats_t, &displayio_refreshstats_type);
+        common_hal_displayio_refreshstats_construct(stats, 1);
+        displayio_area_t second = {0, 8, 16, 16, NULL};
+        displayio_area_t first = {0, 0, 16, 8, &second};
+
+        // Nothing is recorded until it is resumed.
+        displayio_refreshstats_record_frame(&first);
+        mp_printf(&mp_plat_print, "%u\n", (uint)common_hal_displayio_refreshstats_get_frames(stats));
+
+        common_hal_displayio_refreshstats_resume(stats);
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            common_hal_displayio_refreshstats_resume(stats);
+            nlr_pop();
+        } else {
+            mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        }
+        displayio_refreshstats_record_frame(&first);
+        // A frame that only scrolled has no dirty areas.
+        displayio_refreshstats_record_frame(NULL);
+        uint32_t start = displayio_refreshstats_start();
+        displayio_refreshstats_record_layer(mp_const_true, start);
+        displayio_refreshstats_record_layer(mp_const_false, start);
+        displayio_refreshstats_record_layer(mp_const_true, start);
+        displayio_refreshstats_record_composite(start, displayio_area_size(&first));
+        displayio_refreshstats_record_composite(start, displayio_area_size(&second));
+        displayio_refreshstats_record_transfer(start, displayio_area_size(&first));
+        common_hal_displayio_refreshstats_pause(stats);
+        displayio_refreshstats_record_frame(&first);
+
+        mp_printf(&mp_plat_print, "%u %u %u %u\n", (uint)common_hal_displayio_refreshstats_get_frames(stats),
+            (uint)common_hal_displayio_refreshstats_get_dirty_areas(stats),
+            (uint)common_hal_displayio_refreshstats_get_pixels_composited(stats),
+            (uint)common_hal_displayio_refreshstats_get_pixels_sent(stats));
+        mp_obj_tuple_t *layers = MP_OBJ_TO_PTR(common_hal_displayio_refreshstats_get_layers(stats));
+        mp_printf(&mp_plat_print, "%u ", (uint)layers->len);
+        mp_obj_print(mp_obj_subscr(layers->items[0], MP_OBJ_NEW_SMALL_INT(0), MP_OBJ_SENTINEL), PRINT_REPR);
+        mp_printf(&mp_plat_print, "\n");
+    }
+
+    // vectorio spans
+    {
+        mp_printf(&mp_plat_print, "# vectorio spans\n");
+        vectorio_circle_t *circle = mp_obj_malloc(vectorio_circle_t, &vectorio_circle_type);
+        common_hal_vectorio_circle_construct(circle, 7, 0);
+        vectorio_rectangle_t *rectangle = mp_obj_malloc(vectorio_rectangle_t, &vectorio_rectangle_type);
+        common_hal_vectorio_rectangle_construct(rectangle, 5, 3, 0);
+        // A concave W with several spans per row.
+        static const int16_t w_points[] = {0, 0, 2, 0, 4, 4, 6, 0, 8, 4, 10, 0, 12, 0, 9, 7, 6, 3, 3, 7};
+        mp_obj_t points = mp_obj_new_list(0, NULL);
+        for (size_t i = 0; i < MP_ARRAY_SIZE(w_points); i += 2) {
+            mp_obj_t point[] = {MP_OBJ_NEW_SMALL_INT(w_points[i]), MP_OBJ_NEW_SMALL_INT(w_points[i + 1])};
+            mp_obj_list_append(points, mp_obj_new_tuple(2, point));
+        }
+        vectorio_polygon_t *polygon = mp_obj_malloc(vectorio_polygon_t, &vectorio_polygon_type);
+        common_hal_vectorio_polygon_construct(polygon, points, 0);
+
+        // Spans must cover exactly the pixels get_pixel does.
+        vectorio_ishape_t shapes[] = {
+            {circle, common_hal_vectorio_circle_get_area, common_hal_vectorio_circle_get_pixel, common_hal_vectorio_circle_get_spans},
+            {rectangle, common_hal_vectorio_rectangle_get_area, common_hal_vectorio_rectangle_get_pixel, common_hal_vectorio_rectangle_get_spans},
+            {polygon, common_hal_vectorio_polygon_get_area, common_hal_vectorio_polygon_get_pixel, common_hal_vectorio_polygon_get_spans},
+        };
+        for (size_t i = 0; i < MP_ARRAY_SIZE(shapes); i++) {
+            uint32_t span_total = 0;
+            uint32_t mismatches = 0;
+            for (int16_t y = -10; y < 10; y++) {
+                vectorio_span_t spans[8];
+                uint16_t span_count = shapes[i].get_spans(shapes[i].shape, y, spans, 8);
+                span_total += span_count;
+                uint16_t span = 0;
+                for (int16_t x = -10; x < 15; x++) {
+                    while (span < span_count && spans[span].x2 <= x) {
+                        span++;
+                    }
+                    bool in_span = span < span_count && spans[span].x1 <= x;
+                    if (in_span != (shapes[i].get_pixel(shapes[i].shape, x, y) != 0)) {
+                        mismatches++;
+                    }
+                }
+            }
+            mp_printf(&mp_plat_print, "%u %u\n", (uint)span_total, (uint)mismatches);
+        }
+        // Rows with more spans than fit report that.
+        vectorio_span_t span;
+        mp_printf(&mp_plat_print, "%u\n", (uint)common_hal_vectorio_polygon_get_spans(polygon, 1, &span, 1));
+
+        displayio_palette_t *palette = mp_obj_malloc(displayio_palette_t, &displayio_palette_type);
+        common_hal_displayio_palette_construct(palette, 1, false);
+        common_hal_displayio_palette_set_color(palette, 0, 0xffffff);
+        vectorio_vector_shape_t *shape = MP_OBJ_TO_PTR(vectorio_vector_shape_make_new(polygon, palette, 0, 0));
+        _displayio_colorspace_t colorspace = {.depth = 16};
+        displayio_area_t area = {0, 0, 13, 8, NULL};
+        uint32_t mask[13 * 8 / 32 + 1] = {0};
+        uint16_t buffer[13 * 8] = {0};
+        vectorio_vector_shape_fill_area(shape, &colorspace, &area, mask, (uint32_t *)buffer);
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 13; x++) {
+                mp_printf(&mp_plat_print, "%c", buffer[y * 13 + x] != 0 ? '#' : '.');
+            }
+            mp_printf(&mp_plat_print, "\n");
+        }
+
+        // Points that fail validation leave the polygon without any, so nothing is drawn.
+        mp_obj_t point[] = {MP_OBJ_NEW_SMALL_INT(1), mp_const_none};
+        mp_obj_list_store(points, MP_OBJ_NEW_SMALL_INT(2), mp_obj_new_tuple(2, point));
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            common_hal_vectorio_polygon_set_points(polygon, points);
+            nlr_pop();
+        } else {
+            mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        }
+        mp_printf(&mp_plat_print, "%u\n", (uint)common_hal_vectorio_polygon_get_spans(polygon, 1, &span, 1));
+        memset(buffer, 0, sizeof(buffer));
+        vectorio_vector_shape_fill_area(shape, &colorspace, &area, mask, (uint32_t *)buffer);
+        mp_printf(&mp_plat_print, "%d\n", buffer[3 * 13 + 6]);
+    }
+
+    // displayio bitmap rows
+    {
+        mp_printf(&mp_plat_print, "# displayio bitmap rows\n");
+        static const uint8_t depths[] = {1, 2, 4, 8, 16, 32};
+        for (size_t d = 0; d < MP_ARRAY_SIZE(depths); d++) {
+            displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+            common_hal_displayio_bitmap_construct(bitmap, 37, 2, depths[d]);
+            uint32_t value_mask = depths[d] == 32 ? 0xffffffff : (1u << depths[d]) - 1;
+            uint32_t mismatches = 0;
+            // Runs that start and end inside, outside and on byte boundaries.
+            static const int16_t runs[][2] = {{0, 37}, {3, 11}, {8, 16}, {-5, 9}, {30, 12}, {-3, 45}, {5, 0}};
+            for (size_t r = 0; r < MP_ARRAY_SIZE(runs); r++) {
+                int16_t x = runs[r][0];
+                uint16_t count = runs[r][1];
+                uint32_t values[45];
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] = (0x9e3779b9 * (r * 64 + i + 1)) & value_mask;
+                }
+                common_hal_displayio_bitmap_fill(bitmap, 0);
+                displayio_bitmap_write_row(bitmap, x, 1, count, values);
+                for (int16_t i = -5; i < 45; i++) {
+                    bool inside = i >= x && i < x + count && i >= 0 && i < 37;
+                    uint32_t expected = inside ? values[i - x] : 0;
+                    if (common_hal_displayio_bitmap_get_pixel(bitmap, i, 1) != expected ||
+                        common_hal_displayio_bitmap_get_pixel(bitmap, i, 0) != 0) {
+                        mismatches++;
+                    }
+                }
+                uint32_t read[45];
+                displayio_bitmap_read_row(bitmap, x, 1, count, read);
+                for (uint16_t i = 0; i < count; i++) {
+                    if (read[i] != common_hal_displayio_bitmap_get_pixel(bitmap, x + i, 1)) {
+                        mismatches++;
+                    }
+                }
+                displayio_bitmap_fill_row(bitmap, x, 0, count, value_mask);
+                for (int16_t i = -5; i < 45; i++) {
+                    bool inside = i >= x && i < x + count && i >= 0 && i < 37;
+                    if (common_hal_displayio_bitmap_get_pixel(bitmap, i, 0) != (inside ? value_mask : 0)) {
+                        mismatches++;
+                    }
+                }
+            }
+            mp_printf(&mp_plat_print, "%d %u\n", depths[d], (uint)mismatches);
+        }
+    }
+
+    // framebufferio scroll
+    {
+        mp_printf(&mp_plat_print, "# framebufferio scroll\n");
+        extern const mp_obj_type_t memory_framebuffer_type;
+        // 8x8 tiles that differ in every row so that a shift by the wrong amount shows.
+        displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+        common_hal_displayio_bitmap_construct(bitmap, 64, 8, 4);
+        for (int16_t y = 0; y < 8; y++) {
+            for (int16_t x = 0; x < 64; x++) {
+                common_hal_displayio_bitmap_set_pixel(bitmap, x, y, (x / 8 * 3 + x % 8 + y * 5) % 16);
+            }
+        }
+        displayio_palette_t *palette = mp_obj_malloc(displayio_palette_t, &displayio_palette_type);
+        common_hal_displayio_palette_construct(palette, 16, false);
+        for (uint32_t i = 0; i < 16; i++) {
+            common_hal_displayio_palette_set_color(palette, i, i * 0x0f1f0f);
+        }
+        displayio_refreshstats_t *stats = mp_obj_malloc(displayio_refreshstats_t, &displayio_refreshstats_type);
+        common_hal_displayio_refreshstats_construct(stats, 1);
+        common_hal_displayio_refreshstats_resume(stats);
+
+        // Each scrolled refresh must match a full redraw. A layer above the scrolled TileGrid
+        // stops the pixels from being moved.
+        static const struct { uint8_t depth; uint16_t rotation; bool above; } cases[] = {
+            {16, 0, false}, {16, 90, false}, {16, 180, false}, {4, 0, false}, {16, 0, true},
+        };
+        for (size_t c = 0; c < MP_ARRAY_SIZE(cases); c++) {
+            mp_obj_t fb_args[] = {MP_OBJ_NEW_SMALL_INT(64), MP_OBJ_NEW_SMALL_INT(48), MP_OBJ_NEW_QSTR(MP_QSTR_color_depth), MP_OBJ_NEW_SMALL_INT(cases[c].depth)};
+            mp_obj_t fb = mp_call_function_n_kw(MP_OBJ_FROM_PTR(&memory_framebuffer_type), 2, 1, fb_args);
+            framebufferio_framebufferdisplay_obj_t *display = mp_obj_malloc(framebufferio_framebufferdisplay_obj_t, &framebufferio_framebufferdisplay_type);
+            common_hal_framebufferio_framebufferdisplay_construct(display, fb, cases[c].rotation, false);
+            uint16_t width = common_hal_framebufferio_framebufferdisplay_get_width(display);
+            uint16_t height = common_hal_framebufferio_framebufferdisplay_get_height(display);
+
+            displayio_group_t *group = mp_obj_malloc(displayio_group_t, &displayio_group_type);
+            common_hal_displayio_group_construct(group, 1, 0, 0);
+            displayio_tilegrid_t *grid = mp_obj_malloc(displayio_tilegrid_t, &displayio_tilegrid_type);
+            common_hal_displayio_tilegrid_construct(grid, bitmap, 8, 1, palette, width / 8, height / 8, 8, 8, 0, 0, 0);
+            for (uint16_t y = 0; y < height / 8; y++) {
+                for (uint16_t x = 0; x < width / 8; x++) {
+                    common_hal_displayio_tilegrid_set_tile(grid, x, y, (x + y * 3) % 8);
+                }
+            }
+            common_hal_displayio_group_insert(group, 0, grid);
+            if (cases[c].above) {
+                displayio_tilegrid_t *sprite = mp_obj_malloc(displayio_tilegrid_t, &displayio_tilegrid_type);
+                common_hal_displayio_tilegrid_construct(sprite, bitmap, 8, 1, palette, 1, 1, 8, 8, 20, 12, 5);
+                common_hal_displayio_group_insert(group, 1, sprite);
+            }
+            common_hal_framebufferio_framebufferdisplay_set_root_group(display, group);
+            common_hal_framebufferio_framebufferdisplay_refresh(display, NO_FPS_LIMIT, NO_FPS_LIMIT);
+
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(fb, &bufinfo, MP_BUFFER_READ);
+            uint8_t *scrolled = m_new(uint8_t, bufinfo.len);
+            uint32_t composited = 0;
+            uint32_t mismatches = 0;
+            for (uint16_t step = 1; step <= 8; step++) {
+                // Scroll both ways, sometimes changing a tile on the way.
+                common_hal_displayio_tilegrid_set_top_left(grid, 0, step < 6 ? step : 10 - step);
+                if (step % 3 == 0) {
+                    common_hal_displayio_tilegrid_set_tile(grid, 1, step % 4, 7);
+                }
+                uint32_t before = common_hal_displayio_refreshstats_get_pixels_composited(stats);
+                common_hal_framebufferio_framebufferdisplay_refresh(display, NO_FPS_LIMIT, NO_FPS_LIMIT);
+                composited += common_hal_displayio_refreshstats_get_pixels_composited(stats) - before;
+                memcpy(scrolled, bufinfo.buf, bufinfo.len);
+                display->core.full_refresh = true;
+                common_hal_framebufferio_framebufferdisplay_refresh(display, NO_FPS_LIMIT, NO_FPS_LIMIT);
+                for (size_t i = 0; i < bufinfo.len; i++) {
+                    if (scrolled[i] != ((uint8_t *)bufinfo.buf)[i]) {
+                        mismatches++;
+                    }
+                }
+            }
+            m_del(uint8_t, scrolled, bufinfo.len);
+            mp_printf(&mp_plat_print, "%d %d %d %u %u\n", cases[c].depth, cases[c].rotation, cases[c].above, (uint)composited, (uint)mismatches);
+        }
+        common_hal_displayio_refreshstats_pause(stats);
+    }
+
     mp_printf(&mp_plat_print, "# end coverage.c\n");
 
     mp_obj_streamtest_t *s = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_fileio);
@@ -4,14 +4,25 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/enum.h"
+#include "py/gc.h"
+#include "py/mphal.h"
 #include "py/obj.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/displayio/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/RefreshStats.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#include "shared-module/displayio/__init__.h"
+#include "supervisor/shared/display.h"
+#include "supervisor/shared/tick.h"
 
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB888, DISPLAYIO_COLORSPACE_RGB888);
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB565, DISPLAYIO_COLORSPACE_RGB565);
@@ -59,12 +70,96 @@ static MP_DEFINE_CONST_DICT(displayio_colorspace_locals_dict, displayio_colorspa
 MAKE_PRINTER(displayio, displayio_colorspace);
 MAKE_ENUM_TYPE(displayio, ColorSpace, displayio_colorspace);
 
+// The host has no display hardware, only framebufferio displays of framebuffers in memory.
+primary_display_t displays[CIRCUITPY_DISPLAY_LIMIT];
+
+primary_display_t *allocate_display_or_raise(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        mp_const_obj_t display_type = displays[i].display_base.type;
+        if (display_type == NULL || display_type == &mp_type_NoneType) {
+            memset(&displays[i], 0, sizeof(displays[i]));
+            displays[i].display_base.type = &mp_type_NoneType;
+            return &displays[i];
+        }
+    }
+    mp_raise_RuntimeError(MP_ERROR_TEXT("Too many displays"));
+}
+
+void common_hal_displayio_release_displays(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].display_base.type == &framebufferio_framebufferdisplay_type) {
+            release_framebufferdisplay(&displays[i].framebuffer_display);
+        }
+        displays[i].display_base.type = &mp_type_NoneType;
+    }
+}
+
+// Displays live outside the heap, so the collector is told what they reference.
+void displayio_gc_collect(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].display_base.type == &framebufferio_framebufferdisplay_type) {
+            framebufferio_framebufferdisplay_collect_ptrs(&displays[i].framebuffer_display);
+        }
+    }
+}
+
+static mp_obj_t displayio_release_displays(void) {
+    common_hal_displayio_release_displays();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(displayio_release_displays_obj, displayio_release_displays);
+
+// There is no terminal to show on the display and nothing refreshes in the background.
+static mp_obj_t splash_members[] = {};
+static mp_obj_list_t splash_children = {
+    .base = {.type = &mp_type_list },
+    .alloc = 0,
+    .len = 0,
+    .items = splash_members,
+};
+
+displayio_group_t circuitpython_splash = {
+    .base = {.type = &displayio_group_type },
+    .x = 0,
+    .y = 0,
+    .scale = 1,
+    .members = &splash_children,
+    .item_removed = false,
+    .in_group = false,
+    .hidden = false,
+    .hidden_by_parent = false,
+    .readonly = true,
+};
+
+void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
+    (void)width_px;
+    (void)height_px;
+}
+
+void supervisor_stop_terminal(void) {
+}
+
+uint64_t supervisor_ticks_ms64(void) {
+    return mp_hal_ticks_ms();
+}
+
+void supervisor_enable_tick(void) {
+}
+
+void supervisor_disable_tick(void) {
+}
+
 static const mp_rom_map_elem_t displayio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_displayio) },
     { MP_ROM_QSTR(MP_QSTR_Bitmap), MP_ROM_PTR(&displayio_bitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Colorspace), MP_ROM_PTR(&displayio_colorspace_type) },
     { MP_ROM_QSTR(MP_QSTR_ColorConverter), MP_ROM_PTR(&displayio_colorconverter_type) },
+    { MP_ROM_QSTR(MP_QSTR_Group), MP_ROM_PTR(&displayio_group_type) },
+    { MP_ROM_QSTR(MP_QSTR_OnDiskBitmap), MP_ROM_PTR(&displayio_ondiskbitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Palette), MP_ROM_PTR(&displayio_palette_type) },
+    { MP_ROM_QSTR(MP_QSTR_RefreshStats), MP_ROM_PTR(&displayio_refreshstats_type) },
+    { MP_ROM_QSTR(MP_QSTR_TileGrid), MP_ROM_PTR(&displayio_tilegrid_type) },
+    { MP_ROM_QSTR(MP_QSTR_release_displays), MP_ROM_PTR(&displayio_release_displays_obj) },
 };
 static MP_DEFINE_CONST_DICT(displayio_module_globals, displayio_module_globals_table);
 
@@ -364,6 +364,7 @@ static void print_help(char **argv) {
         "  compile-only                 -- parse and compile only\n"
         #if MICROPY_EMIT_NATIVE
         "  emit={bytecode,native,viper} -- set the default code emitter\n"
+        "  emit=native-all              -- emit native code for each function that supports it\n"
         #else
         "  emit=bytecode                -- set the default code emitter\n"
         #endif
@@ -415,6 +416,8 @@ static void pre_process_options(int argc, char **argv) {
                     emit_opt = MP_EMIT_OPT_NATIVE_PYTHON;
                 } else if (strcmp(argv[a + 1], "emit=viper") == 0) {
                     emit_opt = MP_EMIT_OPT_VIPER;
+                } else if (strcmp(argv[a + 1], "emit=native-all") == 0) {
+                    emit_opt = MP_EMIT_OPT_NATIVE_ALL;
                 #endif
                 #if MICROPY_ENABLE_GC
                 } else if (strncmp(argv[a + 1], "heapsize=", sizeof("heapsize=") - 1) == 0) {
@@ -627,6 +630,9 @@ MP_NOINLINE int main_(int argc, char **argv) {
         // CIRCUITPY-CHANGE: test native base classes work as needed by CircuitPython libraries.
         extern const mp_obj_type_t native_base_class_type;
         mp_store_global(MP_QSTR_NativeBaseClass, MP_OBJ_FROM_PTR(&native_base_class_type));
+        // CIRCUITPY-CHANGE: test framebufferio displays against a framebuffer in memory.
+        extern const mp_obj_type_t memory_framebuffer_type;
+        mp_store_global(MP_QSTR_MemoryFramebuffer, MP_OBJ_FROM_PTR(&memory_framebuffer_type));
         mp_store_global(MP_QSTR_getenv_int, MP_OBJ_FROM_PTR(&mod_os_getenv_int_obj));
         mp_store_global(MP_QSTR_getenv_str, MP_OBJ_FROM_PTR(&mod_os_getenv_str_obj));
     }
@@ -0,0 +1,111 @@
+#include <string.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "shared-module/framebufferio/FramebufferDisplay.h"
+
+#if defined(MICROPY_UNIX_COVERAGE)
+
+// A framebuffer in memory so that framebufferio displays can be tested on the host. Its pixels
+// are packed along rows and can be read through the buffer protocol.
+
+typedef struct {
+    mp_obj_base_t base;
+    uint8_t *buf;
+    size_t len;
+    uint16_t width;
+    uint16_t height;
+    uint8_t color_depth;
+} memory_framebuffer_obj_t;
+
+const mp_obj_type_t memory_framebuffer_type;
+
+static mp_obj_t memory_framebuffer_make_new(const mp_obj_type_t *type, size_t n_args,
+    size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_width, ARG_height, ARG_color_depth };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_height, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_color_depth, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    memory_framebuffer_obj_t *self = mp_obj_malloc(memory_framebuffer_obj_t, &memory_framebuffer_type);
+    self->width = mp_arg_validate_int_range(args[ARG_width].u_int, 1, 1024, MP_QSTR_width);
+    self->height = mp_arg_validate_int_range(args[ARG_height].u_int, 1, 1024, MP_QSTR_height);
+    self->color_depth = args[ARG_color_depth].u_int;
+    if (self->color_depth != 1 && self->color_depth != 2 && self->color_depth != 4 &&
+        self->color_depth != 8 && self->color_depth != 16 && self->color_depth != 32) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_color_depth);
+    }
+    self->len = (self->width * self->color_depth + 7) / 8 * self->height;
+    self->buf = m_malloc(self->len);
+    memset(self->buf, 0, self->len);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void memory_framebuffer_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *bufinfo) {
+    memory_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bufinfo->buf = self->buf;
+    bufinfo->len = self->len;
+    bufinfo->typecode = 'B';
+}
+
+static void memory_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmask) {
+}
+
+static void memory_framebuffer_deinit(mp_obj_t self_in) {
+}
+
+static int memory_framebuffer_get_width(mp_obj_t self_in) {
+    memory_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->width;
+}
+
+static int memory_framebuffer_get_height(mp_obj_t self_in) {
+    memory_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->height;
+}
+
+static int memory_framebuffer_get_color_depth(mp_obj_t self_in) {
+    memory_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->color_depth;
+}
+
+static int memory_framebuffer_get_row_stride(mp_obj_t self_in) {
+    memory_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return (self->width * self->color_depth + 7) / 8;
+}
+
+static bool memory_framebuffer_get_pixels_in_byte_share_row(mp_obj_t self_in) {
+    return true;
+}
+
+static const framebuffer_p_t memory_framebuffer_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_framebuffer)
+    .get_bufinfo = memory_framebuffer_get_bufinfo,
+    .swapbuffers = memory_framebuffer_swapbuffers,
+    .deinit = memory_framebuffer_deinit,
+    .get_width = memory_framebuffer_get_width,
+    .get_height = memory_framebuffer_get_height,
+    .get_color_depth = memory_framebuffer_get_color_depth,
+    .get_row_stride = memory_framebuffer_get_row_stride,
+    .get_pixels_in_byte_share_row = memory_framebuffer_get_pixels_in_byte_share_row,
+};
+
+static mp_int_t memory_framebuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    memory_framebuffer_get_bufinfo(self_in, bufinfo);
+    return 0;
+}
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    memory_framebuffer_type,
+    MP_QSTR_MemoryFramebuffer,
+    MP_TYPE_FLAG_NONE,
+    make_new, &memory_framebuffer_make_new,
+    buffer, memory_framebuffer_get_buffer,
+    protocol, &memory_framebuffer_proto
+    );
+
+#endif
@@ -37,6 +37,22 @@
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
 
+// Enable the size-class index of free runs in the GC.
+#define MICROPY_GC_SIZE_CLASSES        (8)
+
+// Record how long garbage collections take.
+#define MICROPY_GC_PAUSE_STATS         (1)
+
+// Enable hash indexes on the qstr pools.
+#define MICROPY_QSTR_HASH_INDEX        (1)
+
+// Enable inline caches for attribute access in the VM.
+#define MICROPY_OPT_ATTR_INLINE_CACHE  (1)
+
+// Enable bytecode superinstructions and quickening.
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (1)
+#define MICROPY_OPT_BC_QUICKEN         (1)
+
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
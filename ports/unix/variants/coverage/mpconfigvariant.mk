@@ -48,8 +48,14 @@ SRC_BITMAP := \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/RefreshStats.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/floppyio/__init__.c \
+	shared-bindings/framebufferio/__init__.c \
+	shared-bindings/framebufferio/FramebufferDisplay.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
@@ -63,6 +69,7 @@ SRC_BITMAP := \
 	shared-bindings/synthio/Biquad.c \
 	shared-bindings/synthio/BlockBiquad.c \
 	shared-bindings/synthio/Synthesizer.c \
+	shared-bindings/synthio/Wavetable.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
 	shared-bindings/vectorio/Circle.c \
@@ -85,13 +92,21 @@ SRC_BITMAP := \
 	shared-module/audiomp3/MP3Decoder.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
+	shared-module/audiomixer/resample.c \
 	shared-module/bitmapfilter/__init__.c \
 	shared-module/bitmaptools/__init__.c \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/display_core.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/OnDiskBitmap.c \
 	shared-module/displayio/Palette.c \
+	shared-module/displayio/RefreshStats.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/floppyio/__init__.c \
+	shared-module/framebufferio/__init__.c \
+	shared-module/framebufferio/FramebufferDisplay.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
 	shared-module/os/getenv.c \
@@ -105,6 +120,7 @@ SRC_BITMAP := \
 	shared-module/synthio/Biquad.c \
 	shared-module/synthio/BlockBiquad.c \
 	shared-module/synthio/Synthesizer.c \
+	shared-module/synthio/Wavetable.c \
 	shared-bindings/vectorio/Circle.c \
 	shared-module/vectorio/Circle.c \
 	shared-module/vectorio/__init__.c \
@@ -148,12 +164,16 @@ CFLAGS += \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
 	-DCIRCUITPY_CODEOP=1 \
+	-DCIRCUITPY_DISPLAY_AREA_BUFFER_SIZE=512 \
+	-DCIRCUITPY_DISPLAY_LIMIT=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
 	-DCIRCUITPY_FLOPPYIO=1 \
+	-DCIRCUITPY_FRAMEBUFFERIO=1 \
 	-DCIRCUITPY_FUTURE=1 \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_ONDISKBITMAP_CACHE_SIZE=64 \
 	-DCIRCUITPY_OS_GETENV=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
@@ -164,6 +184,10 @@ CFLAGS += \
 	-DCIRCUITPY_ZLIB=1
 
 # CIRCUITPY-CHANGE: test native base classes.
-SRC_C += coverage.c native_base_class.c
+SRC_C += coverage.c memory_framebuffer.c native_base_class.c
+
+# CIRCUITPY-CHANGE: test background callbacks, which are lock-free on unix hosts.
+SRC_C += supervisor/shared/background_callback.c
+CFLAGS += -DCIRCUITPY_BACKGROUND_CALLBACK_STATS=1
 SRC_CXX += coveragecpp.cpp
 CIRCUITPY_MESSAGE_COMPRESSION_LEVEL = 1
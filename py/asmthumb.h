@@ -397,6 +397,11 @@ void asm_thumb_b_rel12(asm_thumb_t *as, int rel);
         asm_thumb_cmp_rlo_rlo(as, reg1, reg2); \
         asm_thumb_bcc_label(as, ASM_THUMB_CC_EQ, label); \
     } while (0)
+#define ASM_JUMP_IF_REG_LT(as, reg1, reg2, label) \
+    do { \
+        asm_thumb_cmp_rlo_rlo(as, reg1, reg2); \
+        asm_thumb_bcc_label(as, ASM_THUMB_CC_LT, label); \
+    } while (0)
 #define ASM_JUMP_REG(as, reg) asm_thumb_bx_reg((as), (reg))
 #define ASM_CALL_IND(as, idx) asm_thumb_bl_ind(as, idx, ASM_THUMB_REG_R3)
 
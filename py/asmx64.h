@@ -184,6 +184,11 @@ void asm_x64_call_ind(asm_x64_t *as, size_t fun_id, int temp_r32);
         asm_x64_cmp_r64_with_r64(as, reg1, reg2); \
         asm_x64_jcc_label(as, ASM_X64_CC_JE, label); \
     } while (0)
+#define ASM_JUMP_IF_REG_LT(as, reg1, reg2, label) \
+    do { \
+        asm_x64_cmp_r64_with_r64(as, reg2, reg1); \
+        asm_x64_jcc_label(as, ASM_X64_CC_JL, label); \
+    } while (0)
 #define ASM_JUMP_REG(as, reg) asm_x64_jmp_reg((as), (reg))
 #define ASM_CALL_IND(as, idx) asm_x64_call_ind(as, idx, ASM_X64_REG_RAX)
 
@@ -179,6 +179,11 @@ void asm_x86_call_ind(asm_x86_t *as, size_t fun_id, mp_uint_t n_args, int temp_r
         asm_x86_cmp_r32_with_r32(as, reg1, reg2); \
         asm_x86_jcc_label(as, ASM_X86_CC_JE, label); \
     } while (0)
+#define ASM_JUMP_IF_REG_LT(as, reg1, reg2, label) \
+    do { \
+        asm_x86_cmp_r32_with_r32(as, reg2, reg1); \
+        asm_x86_jcc_label(as, ASM_X86_CC_JL, label); \
+    } while (0)
 #define ASM_JUMP_REG(as, reg) asm_x86_jmp_reg((as), (reg))
 #define ASM_CALL_IND(as, idx) asm_x86_call_ind(as, idx, mp_f_n_args[idx], ASM_X86_REG_EAX)
 
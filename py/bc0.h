@@ -159,4 +159,25 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// Superinstructions, each equivalent to a pair of the opcodes above.  They are
+// only emitted when MICROPY_OPT_BC_SUPERINSTRUCTIONS is enabled.
+#define MP_BC_LOAD_ATTR_LOCAL_0             (MP_BC_BASE_QSTR_O + 0x0d) // qstr; LOAD_FAST 0, LOAD_ATTR
+#define MP_BC_LOAD_METHOD_LOCAL_0           (MP_BC_BASE_QSTR_O + 0x0e) // qstr; LOAD_FAST 0, LOAD_METHOD
+#define MP_BC_STORE_ATTR_LOCAL_0            (MP_BC_BASE_QSTR_O + 0x0f) // qstr; LOAD_FAST 0, STORE_ATTR
+#define MP_BC_BINARY_OP_POP_JUMP_IF         (MP_BC_BASE_JUMP_E + 0x01) // signed relative bytecode offset; then a byte: op | cond << 7
+
+// Quickened opcodes, which the VM writes over BINARY_OP_MULTI in bytecode that
+// is in RAM once the op has seen small int arguments.  They are never emitted
+// by the compiler nor saved in .mpy files.  See MICROPY_OPT_BC_QUICKEN.
+#define MP_BC_BINARY_OP_SMALL_INT_LESS      (MP_BC_BASE_RESERVED + 0x02)
+#define MP_BC_BINARY_OP_SMALL_INT_MORE      (MP_BC_BASE_RESERVED + 0x03)
+#define MP_BC_BINARY_OP_SMALL_INT_EQUAL     (MP_BC_BASE_RESERVED + 0x04)
+#define MP_BC_BINARY_OP_SMALL_INT_LESS_EQUAL (MP_BC_BASE_RESERVED + 0x05)
+#define MP_BC_BINARY_OP_SMALL_INT_MORE_EQUAL (MP_BC_BASE_RESERVED + 0x06)
+#define MP_BC_BINARY_OP_SMALL_INT_NOT_EQUAL (MP_BC_BASE_RESERVED + 0x07)
+#define MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD (MP_BC_BASE_RESERVED + 0x08)
+#define MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT (MP_BC_BASE_RESERVED + 0x09)
+#define MP_BC_BINARY_OP_SMALL_INT_ADD       (MP_BC_BASE_RESERVED + 0x0a)
+#define MP_BC_BINARY_OP_SMALL_INT_SUBTRACT  (MP_BC_BASE_RESERVED + 0x0b)
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -632,6 +632,7 @@ SRC_SHARED_MODULE_ALL = \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
 	audiomixer/__init__.c \
+	audiomixer/resample.c \
 	audiomp3/MP3Decoder.c \
 	audiomp3/__init__.c \
 	audiopwmio/__init__.c \
@@ -657,6 +658,7 @@ SRC_SHARED_MODULE_ALL = \
 	displayio/Group.c \
 	displayio/OnDiskBitmap.c \
 	displayio/Palette.c \
+	displayio/RefreshStats.c \
 	displayio/TileGrid.c \
 	displayio/area.c \
 	displayio/__init__.c \
@@ -724,6 +726,7 @@ SRC_SHARED_MODULE_ALL = \
 	synthio/MidiTrack.c \
 	synthio/Note.c \
 	synthio/Synthesizer.c \
+	synthio/Wavetable.c \
 	synthio/__init__.c \
 	terminalio/Terminal.c \
 	terminalio/__init__.c \
@@ -66,6 +66,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_EMIT_INLINE_THUMB        (CIRCUITPY_ENABLE_MPY_NATIVE)
 #define MICROPY_EMIT_THUMB               (CIRCUITPY_ENABLE_MPY_NATIVE)
 #define MICROPY_EMIT_X64                 (0)
+#define MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH (CIRCUITPY_ENABLE_MPY_NATIVE)
 #define MICROPY_ENABLE_DOC_STRING        (0)
 #define MICROPY_ENABLE_FINALISER         (1)
 #define MICROPY_ENABLE_GC                (1)
@@ -91,6 +92,9 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
+#define MICROPY_OPT_ATTR_INLINE_CACHE   (CIRCUITPY_OPT_ATTR_INLINE_CACHE)
+#define MICROPY_OPT_BC_QUICKEN           (CIRCUITPY_OPT_BC_QUICKEN)
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
@@ -241,6 +245,7 @@ typedef long mp_off_t;
 #define MICROPY_PY_BUILTINS_STR_CENTER        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_PARTITION     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES    (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_FAST_STR_SEARCH           (CIRCUITPY_FULL_BUILD)
 #ifndef MICROPY_PY_COLLECTIONS_ORDEREDDICT
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT    (CIRCUITPY_FULL_BUILD)
 #endif
@@ -272,6 +277,8 @@ typedef long mp_off_t;
 #ifdef LONGINT_IMPL_MPZ
 #define MICROPY_LONGINT_IMPL (MICROPY_LONGINT_IMPL_MPZ)
 #define MP_SSIZE_MAX (0x7fffffff)
+#define MICROPY_OPT_MPZ_KARATSUBA (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_MPZ_MONTGOMERY (CIRCUITPY_FULL_BUILD)
 #endif
 
 #ifdef LONGINT_IMPL_LONGLONG
@@ -357,6 +364,11 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// OnDiskBitmap row cache size in bytes. At least one row is cached regardless.
+#ifndef CIRCUITPY_ONDISKBITMAP_CACHE_SIZE
+#define CIRCUITPY_ONDISKBITMAP_CACHE_SIZE (1024)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
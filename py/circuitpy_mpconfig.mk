@@ -194,6 +194,10 @@ CFLAGS += -DCIRCUITPY_BUSIO_I2C=$(CIRCUITPY_BUSIO_I2C)
 CIRCUITPY_BUSIO_SPI ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_BUSIO_SPI=$(CIRCUITPY_BUSIO_SPI)
 
+# Set by ports whose SPI can write in the background.
+CIRCUITPY_BUSIO_SPI_NONBLOCKING ?= 0
+CFLAGS += -DCIRCUITPY_BUSIO_SPI_NONBLOCKING=$(CIRCUITPY_BUSIO_SPI_NONBLOCKING)
+
 CIRCUITPY_BUSIO_UART ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_BUSIO_UART=$(CIRCUITPY_BUSIO_UART)
 
@@ -246,6 +250,10 @@ CIRCUITPY_PARALLELDISPLAYBUS = 0
 endif
 CFLAGS += -DCIRCUITPY_PARALLELDISPLAYBUS=$(CIRCUITPY_PARALLELDISPLAYBUS)
 
+# Set by ports whose ParallelBus can send pixel data in the background.
+CIRCUITPY_PARALLELDISPLAYBUS_NONBLOCKING ?= 0
+CFLAGS += -DCIRCUITPY_PARALLELDISPLAYBUS_NONBLOCKING=$(CIRCUITPY_PARALLELDISPLAYBUS_NONBLOCKING)
+
 CIRCUITPY_DOTCLOCKFRAMEBUFFER ?= 0
 CFLAGS += -DCIRCUITPY_DOTCLOCKFRAMEBUFFER=$(CIRCUITPY_DOTCLOCKFRAMEBUFFER)
 
@@ -394,6 +402,15 @@ CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 CIRCUITPY_ONEWIREIO ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 
+CIRCUITPY_OPT_ATTR_INLINE_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_ATTR_INLINE_CACHE=$(CIRCUITPY_OPT_ATTR_INLINE_CACHE)
+
+CIRCUITPY_OPT_BC_QUICKEN ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_BC_QUICKEN=$(CIRCUITPY_OPT_BC_QUICKEN)
+
+CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_BC_SUPERINSTRUCTIONS=$(CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS)
+
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
@@ -367,7 +367,8 @@ static void compile_store_id(compiler_t *comp, qstr qst) {
 
 static void compile_delete_id(compiler_t *comp, qstr qst) {
     if (comp->pass == MP_PASS_SCOPE) {
-        mp_emit_common_get_id_for_modification(comp->scope_cur, qst);
+        id_info_t *id = mp_emit_common_get_id_for_modification(comp->scope_cur, qst);
+        id->flags |= ID_FLAG_IS_DELETED;
     } else {
         #if NEED_METHOD_TABLE
         mp_emit_common_id_op(comp->emit, &comp->emit_method_table->delete_id, comp->scope_cur, qst);
@@ -431,6 +432,7 @@ static void c_if_cond(compiler_t *comp, mp_parse_node_t pn, bool jump_if, int la
     // nothing special, fall back to default compiling for node and jump
     compile_node(comp, pn);
     EMIT_ARG(pop_jump_if, jump_if, label);
+    reserve_labels_for_native(comp, 2); // used by native's True/False test
 }
 
 typedef enum { ASSIGN_STORE, ASSIGN_AUG_LOAD, ASSIGN_AUG_STORE } assign_kind_t;
@@ -1445,6 +1447,7 @@ static void compile_for_stmt_optimised_range(compiler_t *comp, mp_parse_node_t p
     // compile: var + step
     compile_node(comp, pn_step);
     EMIT_ARG(binary_op, MP_BINARY_OP_INPLACE_ADD);
+    reserve_labels_for_native(comp, 2); // used by native's small-int fast path
 
     EMIT_ARG(label_assign, entry_label);
 
@@ -1462,7 +1465,9 @@ static void compile_for_stmt_optimised_range(compiler_t *comp, mp_parse_node_t p
     } else {
         EMIT_ARG(binary_op, MP_BINARY_OP_MORE);
     }
+    reserve_labels_for_native(comp, 2); // used by native's small-int fast path
     EMIT_ARG(pop_jump_if, true, top_label);
+    reserve_labels_for_native(comp, 2); // used by native's True/False test
 
     // break/continue apply to outer loop (if any) in the else block
     END_BREAK_CONTINUE_BLOCK
@@ -1626,6 +1631,7 @@ static void compile_try_except(compiler_t *comp, mp_parse_node_t pn_body, int n_
             compile_node(comp, pns_exception_expr);
             EMIT_ARG(binary_op, MP_BINARY_OP_EXCEPTION_MATCH);
             EMIT_ARG(pop_jump_if, false, end_finally_label);
+            reserve_labels_for_native(comp, 2); // used by native's True/False test
         }
 
         // either discard or store the exception instance
@@ -1821,6 +1827,7 @@ static void compile_async_for_stmt(compiler_t *comp, mp_parse_node_struct_t *pns
     EMIT_LOAD_GLOBAL(MP_QSTR_StopAsyncIteration);
     EMIT_ARG(binary_op, MP_BINARY_OP_EXCEPTION_MATCH);
     EMIT_ARG(pop_jump_if, false, try_finally_label);
+    reserve_labels_for_native(comp, 2); // used by native's True/False test
     EMIT(pop_top); // pop exception instance
     EMIT_ARG(pop_except_jump, while_else_label, true);
 
@@ -1907,6 +1914,7 @@ static void compile_async_with_stmt_helper(compiler_t *comp, size_t n, mp_parse_
         EMIT_LOAD_GLOBAL(MP_QSTR_BaseException);
         EMIT_ARG(binary_op, MP_BINARY_OP_EXCEPTION_MATCH);
         EMIT_ARG(pop_jump_if, false, l_ret_unwind_jump); // if not an exception then we have case 3
+        reserve_labels_for_native(comp, 2); // used by native's True/False test
 
         // Handle case 2: call __aexit__ and either swallow or re-raise the exception
         // Stack: (..., ctx_mgr, exc)
@@ -1930,6 +1938,7 @@ static void compile_async_with_stmt_helper(compiler_t *comp, size_t n, mp_parse_
         EMIT_ARG(call_method, 3, 0, 0);
         compile_yield_from(comp);
         EMIT_ARG(pop_jump_if, false, l_end);
+        reserve_labels_for_native(comp, 2); // used by native's True/False test
         EMIT(pop_top); // pop exception
         EMIT_ARG(load_const_tok, MP_TOKEN_KW_NONE); // replace with None to swallow exception
         EMIT_ARG(jump, l_end);
@@ -1961,6 +1970,13 @@ static void compile_async_with_stmt_helper(compiler_t *comp, size_t n, mp_parse_
 }
 
 static void compile_async_with_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
+    #if MICROPY_EMIT_NATIVE
+    if (comp->emit_method_table != &emit_bc_method_table) {
+        // the finally block above relies on the bytecode layout of the unwind state
+        mp_raise_NotImplementedError(MP_ERROR_TEXT("native async with"));
+    }
+    #endif
+
     // get the nodes for the pre-bit of the with (the a as b, c as d, ... bit)
     mp_parse_node_t *nodes;
     size_t n = mp_parse_node_extract_list(&pns->nodes[0], PN_with_stmt_list, &nodes);
@@ -2046,6 +2062,7 @@ static void compile_expr_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
             mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(pns1->nodes[0]);
             mp_binary_op_t op = MP_BINARY_OP_INPLACE_OR + (tok - MP_TOKEN_DEL_PIPE_EQUAL);
             EMIT_ARG(binary_op, op);
+            reserve_labels_for_native(comp, 2); // used by native's small-int fast path
             c_assign(comp, pns->nodes[0], ASSIGN_AUG_STORE); // lhs store for aug assign
         } else if (kind == PN_expr_stmt_assign_list) {
             int rhs = MP_PARSE_NODE_STRUCT_NUM_NODES(pns1) - 1;
@@ -2191,6 +2208,7 @@ static void compile_or_and_test(compiler_t *comp, mp_parse_node_struct_t *pns) {
         compile_node(comp, pns->nodes[i]);
         if (i + 1 < n) {
             EMIT_ARG(jump_if_or_pop, cond, l_end);
+            reserve_labels_for_native(comp, 2); // used by native's True/False test
         }
     }
     EMIT_ARG(label_assign, l_end);
@@ -2224,6 +2242,7 @@ static void compile_comparison(compiler_t *comp, mp_parse_node_struct_t *pns) {
                 op = MP_BINARY_OP_LESS + (tok - MP_TOKEN_OP_LESS);
             }
             EMIT_ARG(binary_op, op);
+            reserve_labels_for_native(comp, 2); // used by native's small-int fast path
         } else {
             assert(MP_PARSE_NODE_IS_STRUCT(pns->nodes[i])); // should be
             mp_parse_node_struct_t *pns2 = (mp_parse_node_struct_t *)pns->nodes[i];
@@ -2241,6 +2260,7 @@ static void compile_comparison(compiler_t *comp, mp_parse_node_struct_t *pns) {
         }
         if (i + 2 < num_nodes) {
             EMIT_ARG(jump_if_or_pop, false, l_fail);
+            reserve_labels_for_native(comp, 2); // used by native's True/False test
         }
     }
     if (multi) {
@@ -2278,6 +2298,7 @@ static void compile_term(compiler_t *comp, mp_parse_node_struct_t *pns) {
         mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(pns->nodes[i]);
         mp_binary_op_t op = MP_BINARY_OP_LSHIFT + (tok - MP_TOKEN_OP_DBL_LESS);
         EMIT_ARG(binary_op, op);
+        reserve_labels_for_native(comp, 2); // used by native's small-int fast path
     }
 }
 
@@ -3054,7 +3075,7 @@ static bool compile_scope(compiler_t *comp, scope_t *scope, pass_kind_t pass) {
     comp->next_label = 0;
     mp_emit_common_start_pass(&comp->emit_common, pass);
     EMIT_ARG(start_pass, pass, scope);
-    reserve_labels_for_native(comp, 6); // used by native's start_pass
+    reserve_labels_for_native(comp, 7); // used by native's start_pass
 
     if (comp->pass == MP_PASS_SCOPE) {
         // reset maximum stack sizes in scope
@@ -3481,6 +3502,70 @@ static void scope_compute_things(scope_t *scope) {
     }
 }
 
+static void compile_scope_all_passes(compiler_t *comp, scope_t *s) {
+    // need a pass to compute stack size
+    compile_scope(comp, s, MP_PASS_STACK_SIZE);
+
+    // second last pass: compute code size
+    if (comp->compile_error == MP_OBJ_NULL) {
+        compile_scope(comp, s, MP_PASS_CODE_SIZE);
+    }
+
+    // final pass: emit code
+    // the emitter can request multiple of these passes
+    if (comp->compile_error == MP_OBJ_NULL) {
+        while (!compile_scope(comp, s, MP_PASS_EMIT)) {
+        }
+    }
+}
+
+#if MICROPY_EMIT_NATIVE
+// Compile a scope with the native emitter, which must already be selected, and
+// if that fails then report why and compile the scope as bytecode instead.  The
+// native emitter is discarded after a failure because it may have been left
+// part way through a pass.
+// Any error here is specific to the native emitter because all syntax errors
+// have already been found by MP_PASS_SCOPE.
+static void compile_scope_native_or_bytecode(compiler_t *comp, scope_t *s, emit_t **emit_native, emit_t *emit_bc, qstr source_file) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        compile_scope_all_passes(comp, s);
+        nlr_pop();
+    } else {
+        comp->compile_error = MP_OBJ_FROM_PTR(nlr.ret_val);
+    }
+
+    if (comp->compile_error == MP_OBJ_NULL) {
+        return;
+    }
+
+    #if MICROPY_DYNAMIC_COMPILER
+    // the cross compiler reports each fallback; at runtime it is silent
+    compile_error_set_line(comp, s->pn);
+    mp_printf(MICROPY_ERROR_PRINTER, "%q:%u: '%q' kept as bytecode: ",
+        source_file, (uint)comp->compile_error_line, s->simple_name);
+    mp_obj_print_helper(MICROPY_ERROR_PRINTER, comp->compile_error, PRINT_EXC);
+    mp_print_str(MICROPY_ERROR_PRINTER, "\n");
+    #else
+    (void)source_file;
+    #endif
+
+    // the failed passes may have left the compiler state anywhere in the scope
+    NATIVE_EMITTER(free)(*emit_native);
+    *emit_native = NULL;
+    comp->compile_error = MP_OBJ_NULL;
+    comp->compile_error_line = 0;
+    comp->break_label = INVALID_LABEL;
+    comp->continue_label = INVALID_LABEL;
+    comp->cur_except_level = 0;
+    comp->break_continue_except_level = 0;
+
+    comp->emit = emit_bc;
+    comp->emit_method_table = &emit_bc_method_table;
+    compile_scope_all_passes(comp, s);
+}
+#endif
+
 #if !MICROPY_PERSISTENT_CODE_SAVE
 static
 #endif
@@ -3577,11 +3662,20 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
 
             // choose the emit type
 
-            switch (s->emit_options) {
+            uint emit_options = s->emit_options;
+            #if MICROPY_EMIT_NATIVE
+            if (emit_options == MP_EMIT_OPT_NATIVE_ALL && (s->kind == SCOPE_MODULE || s->kind == SCOPE_CLASS)) {
+                // module and class bodies only run once so they stay as bytecode
+                emit_options = MP_EMIT_OPT_BYTECODE;
+            }
+            #endif
+
+            switch (emit_options) {
 
                 #if MICROPY_EMIT_NATIVE
                 case MP_EMIT_OPT_NATIVE_PYTHON:
                 case MP_EMIT_OPT_VIPER:
+                case MP_EMIT_OPT_NATIVE_ALL:
                     if (emit_native == NULL) {
                         emit_native = NATIVE_EMITTER(new)(&comp->emit_common, &comp->compile_error, &comp->next_label, max_num_labels);
                     }
@@ -3598,20 +3692,14 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
                     break;
             }
 
-            // need a pass to compute stack size
-            compile_scope(comp, s, MP_PASS_STACK_SIZE);
-
-            // second last pass: compute code size
-            if (comp->compile_error == MP_OBJ_NULL) {
-                compile_scope(comp, s, MP_PASS_CODE_SIZE);
+            #if MICROPY_EMIT_NATIVE
+            if (emit_options == MP_EMIT_OPT_NATIVE_ALL) {
+                compile_scope_native_or_bytecode(comp, s, &emit_native, emit_bc, source_file);
+                continue;
             }
+            #endif
 
-            // final pass: emit code
-            // the emitter can request multiple of these passes
-            if (comp->compile_error == MP_OBJ_NULL) {
-                while (!compile_scope(comp, s, MP_PASS_EMIT)) {
-                }
-            }
+            compile_scope_all_passes(comp, s);
         }
     }
 
@@ -3629,8 +3717,9 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     #if MICROPY_PERSISTENT_CODE_SAVE
     cm->has_native = false;
     #if MICROPY_EMIT_NATIVE
-    if (emit_native != NULL) {
-        cm->has_native = true;
+    // with emit=native-all every function may have fallen back to bytecode
+    for (scope_t *s = comp->scope_head; s != NULL && !cm->has_native; s = s->next) {
+        cm->has_native = s->raw_code->kind == MP_CODE_NATIVE_PY || s->raw_code->kind == MP_CODE_NATIVE_VIPER;
     }
     #endif
     #if MICROPY_EMIT_INLINE_ASM
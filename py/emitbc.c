@@ -73,6 +73,12 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    // The last single-byte opcode that may start a superinstruction, and its offset.
+    byte fuse_opcode;
+    size_t fuse_offset;
+    #endif
 };
 
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
@@ -280,6 +286,28 @@ static void emit_write_bytecode_byte_label(emit_t *emit, int stack_adj, byte b1,
     }
 }
 
+#if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+static void emit_bc_fuse_candidate(emit_t *emit, byte opcode) {
+    emit->fuse_opcode = opcode;
+    emit->fuse_offset = emit->bytecode_offset;
+}
+
+// If the opcode just emitted is the given one, and nothing can jump to or be
+// assigned a source line after it, remove it so it can be fused into the next
+// opcode.  This makes the same decision in every pass.
+static bool emit_bc_fuse_take(emit_t *emit, byte opcode) {
+    if (emit->suppress
+        || emit->fuse_opcode != opcode
+        || emit->fuse_offset + 1 != emit->bytecode_offset
+        || emit->last_source_line_offset > emit->fuse_offset) {
+        return false;
+    }
+    emit->bytecode_offset = emit->fuse_offset;
+    emit->fuse_opcode = 0;
+    return true;
+}
+#endif
+
 void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->pass = pass;
     emit->stack_size = 0;
@@ -290,6 +318,9 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    emit->fuse_opcode = 0;
+    #endif
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -461,6 +492,11 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
 
     // Assign label offset.
     emit->label_offsets[l] = emit->bytecode_offset;
+
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    // Code may jump here, so the previous opcode can't be fused with the next.
+    emit->fuse_opcode = 0;
+    #endif
 }
 
 void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
@@ -512,6 +548,9 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        emit_bc_fuse_candidate(emit, MP_BC_LOAD_FAST_MULTI + local_num);
+        #endif
         emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, 1, MP_BC_LOAD_FAST_N + kind, local_num);
@@ -527,6 +566,12 @@ void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
 
 void mp_emit_bc_load_method(emit_t *emit, qstr qst, bool is_super) {
     int stack_adj = 1 - 2 * is_super;
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    if (!is_super && emit_bc_fuse_take(emit, MP_BC_LOAD_FAST_MULTI)) {
+        emit_write_bytecode_byte_qstr(emit, stack_adj, MP_BC_LOAD_METHOD_LOCAL_0, qst);
+        return;
+    }
+    #endif
     emit_write_bytecode_byte_qstr(emit, stack_adj, is_super ? MP_BC_LOAD_SUPER_METHOD : MP_BC_LOAD_METHOD, qst);
 }
 
@@ -548,12 +593,24 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
     if (kind == MP_EMIT_ATTR_LOAD) {
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        if (emit_bc_fuse_take(emit, MP_BC_LOAD_FAST_MULTI)) {
+            emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR_LOCAL_0, qst);
+            return;
+        }
+        #endif
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
         if (kind == MP_EMIT_ATTR_DELETE) {
             mp_emit_bc_load_null(emit);
             mp_emit_bc_rot_two(emit);
         }
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        else if (emit_bc_fuse_take(emit, MP_BC_LOAD_FAST_MULTI)) {
+            emit_write_bytecode_byte_qstr(emit, -2, MP_BC_STORE_ATTR_LOCAL_0, qst);
+            return;
+        }
+        #endif
         emit_write_bytecode_byte_qstr(emit, -2, MP_BC_STORE_ATTR, qst);
     }
 }
@@ -614,6 +671,17 @@ void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    if (emit->fuse_opcode >= MP_BC_BINARY_OP_MULTI) {
+        byte opcode = emit->fuse_opcode;
+        if (emit_bc_fuse_take(emit, opcode)) {
+            // The stack adjustment of the binary op has already been made.
+            emit_write_bytecode_byte_label(emit, -1, MP_BC_BINARY_OP_POP_JUMP_IF, label);
+            emit_write_bytecode_raw_byte(emit, (opcode - MP_BC_BINARY_OP_MULTI) | cond << 7);
+            return;
+        }
+    }
+    #endif
     if (cond) {
         emit_write_bytecode_byte_label(emit, -1, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -702,6 +770,11 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    if (!invert) {
+        emit_bc_fuse_candidate(emit, MP_BC_BINARY_OP_MULTI + op);
+    }
+    #endif
     emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
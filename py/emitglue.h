@@ -43,6 +43,7 @@ enum {
     MP_EMIT_OPT_NATIVE_PYTHON,
     MP_EMIT_OPT_VIPER,
     MP_EMIT_OPT_ASM,
+    MP_EMIT_OPT_NATIVE_ALL, // native for each function that supports it, else bytecode
 };
 
 typedef enum {
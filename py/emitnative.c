@@ -153,9 +153,14 @@
 #define NEED_FUN_OBJ(emit) ((emit)->scope->exc_stack_size > 0 \
     || ((emit)->scope->scope_flags & (MP_SCOPE_FLAG_REFGLOBALS | MP_SCOPE_FLAG_HASCONSTS)))
 
+// Whether the function stands in for bytecode (emit=native-all), and so must check
+// for unbound locals and record traceback entries the way the VM does
+#define NEED_BYTECODE_SEMANTICS(emit) ((emit)->scope->emit_options == MP_EMIT_OPT_NATIVE_ALL)
+
 // Whether the native/viper function needs to be wrapped in an exception handler
 #define NEED_GLOBAL_EXC_HANDLER(emit) ((emit)->scope->exc_stack_size > 0 \
-    || ((emit)->scope->scope_flags & (MP_SCOPE_FLAG_GENERATOR | MP_SCOPE_FLAG_REFGLOBALS)))
+    || ((emit)->scope->scope_flags & (MP_SCOPE_FLAG_GENERATOR | MP_SCOPE_FLAG_REFGLOBALS)) \
+    || NEED_BYTECODE_SEMANTICS(emit))
 
 // Whether a slot is needed to store LOCAL_IDX_EXC_HANDLER_UNWIND
 #define NEED_EXC_HANDLER_UNWIND(emit) ((emit)->scope->exc_stack_size > 0)
@@ -174,6 +179,7 @@
 #define LOCAL_IDX_OLD_GLOBALS(emit) ((emit)->code_state_start + OFFSETOF_CODE_STATE_IP)
 #define LOCAL_IDX_GEN_PC(emit) ((emit)->code_state_start + OFFSETOF_CODE_STATE_IP)
 #define LOCAL_IDX_LOCAL_VAR(emit, local_num) ((emit)->stack_start + (emit)->n_state - 1 - (local_num))
+#define LOCAL_IDX_SOURCE_LINE(emit) LOCAL_IDX_LOCAL_VAR(emit, (emit)->scope->num_locals) // when NEED_BYTECODE_SEMANTICS is true
 
 #if MICROPY_PERSISTENT_CODE_SAVE
 
@@ -280,6 +286,8 @@ struct _emit_t {
     mp_obj_t *error_slot;
     uint *label_slot;
     uint exit_label;
+    uint unbound_label;
+    bool need_unbound_stub;
     int pass;
 
     bool do_viper_types;
@@ -304,6 +312,7 @@ struct _emit_t {
     int stack_size;
     uint16_t n_info;
     uint16_t n_cell;
+    mp_uint_t source_line;
 
     scope_t *scope;
 
@@ -314,6 +323,7 @@ static void emit_load_reg_with_object(emit_t *emit, int reg, mp_obj_t obj);
 static void emit_native_global_exc_entry(emit_t *emit);
 static void emit_native_global_exc_exit(emit_t *emit);
 static void emit_native_load_const_obj(emit_t *emit, mp_obj_t obj);
+static void emit_native_store_source_line(emit_t *emit, mp_uint_t source_line);
 
 emit_t *EXPORT_FUN(new)(mp_emit_common_t * emit_common, mp_obj_t *error_slot, uint *label_slot, mp_uint_t max_num_labels) {
     emit_t *emit = m_new0(emit_t, 1);
@@ -398,6 +408,8 @@ static void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
     emit->do_viper_types = scope->emit_options == MP_EMIT_OPT_VIPER;
     emit->stack_size = 0;
     emit->scope = scope;
+    emit->need_unbound_stub = false;
+    emit->source_line = 0;
 
     // allocate memory for keeping track of the types of locals
     if (emit->local_vtype_alloc < scope->num_locals) {
@@ -545,8 +557,11 @@ static void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
         emit_native_global_exc_entry(emit);
 
     } else {
-        // work out size of state (locals plus stack)
+        // work out size of state (locals plus stack, plus the current line if needed)
         emit->n_state = scope->num_locals + scope->stack_size;
+        if (NEED_BYTECODE_SEMANTICS(emit)) {
+            emit->n_state += 1;
+        }
 
         // Store in the first machine-word an index used to the function's prelude.
         // This is used at runtime by mp_obj_fun_native_get_prelude_ptr().
@@ -803,8 +818,10 @@ static void emit_native_adjust_stack_size(emit_t *emit, mp_int_t delta) {
 }
 
 static void emit_native_set_source_line(emit_t *emit, mp_uint_t source_line) {
-    (void)emit;
-    (void)source_line;
+    if (NEED_BYTECODE_SEMANTICS(emit) && source_line != emit->source_line) {
+        emit->source_line = source_line;
+        emit_native_store_source_line(emit, source_line);
+    }
 }
 
 // this must be called at start of emit functions
@@ -1151,6 +1168,13 @@ static void emit_load_reg_with_child(emit_t *emit, int reg, mp_raw_code_t *rc) {
     ASM_LOAD_REG_REG_OFFSET(emit->as, reg, REG_TEMP0, table_off);
 }
 
+// Keep the line the VM would report for the code that follows in the state, where
+// the global exception handler reads it (only when NEED_BYTECODE_SEMANTICS is true)
+static void emit_native_store_source_line(emit_t *emit, mp_uint_t source_line) {
+    need_reg_single(emit, REG_TEMP0, 0);
+    emit_native_mov_state_imm_via(emit, LOCAL_IDX_SOURCE_LINE(emit), source_line, REG_TEMP0);
+}
+
 static void emit_native_label_assign(emit_t *emit, mp_uint_t l) {
     DEBUG_printf("label_assign(" UINT_FMT ")\n", l);
 
@@ -1171,6 +1195,10 @@ static void emit_native_label_assign(emit_t *emit, mp_uint_t l) {
     // need to commit stack because we can jump here from elsewhere
     need_stack_settled(emit);
     mp_asm_base_label_assign(&emit->as->base, l);
+    if (NEED_BYTECODE_SEMANTICS(emit) && emit->source_line != 0) {
+        // control can arrive here from code with a different line
+        emit_native_store_source_line(emit, emit->source_line);
+    }
     emit_post(emit);
 
     if (is_finally) {
@@ -1179,10 +1207,21 @@ static void emit_native_label_assign(emit_t *emit, mp_uint_t l) {
     }
 }
 
+// Add the traceback entry the VM would add for the exception in LOCAL_IDX_EXC_VAL
+static void emit_native_add_traceback(emit_t *emit) {
+    ASM_MOV_REG_LOCAL(emit->as, REG_ARG_1, LOCAL_IDX_EXC_VAL(emit));
+    emit_native_mov_reg_state(emit, REG_ARG_2, LOCAL_IDX_FUN_OBJ(emit));
+    emit_native_mov_reg_state(emit, REG_ARG_3, LOCAL_IDX_SOURCE_LINE(emit));
+    emit_native_mov_reg_qstr(emit, REG_ARG_4, emit->scope->simple_name);
+    emit_call(emit, MP_F_NATIVE_ADD_TRACEBACK);
+}
+
 static void emit_native_global_exc_entry(emit_t *emit) {
-    // Note: 4 labels are reserved for this function, starting at *emit->label_slot
+    // Note: 4 labels are reserved for this function, starting at *emit->label_slot,
+    // and one more at *emit->label_slot + 6 for the unbound local stub
 
     emit->exit_label = *emit->label_slot;
+    emit->unbound_label = *emit->label_slot + 6;
 
     if (NEED_GLOBAL_EXC_HANDLER(emit)) {
         mp_uint_t nlr_label = *emit->label_slot + 1;
@@ -1201,7 +1240,7 @@ static void emit_native_global_exc_entry(emit_t *emit) {
         }
 
         if (emit->scope->exc_stack_size == 0) {
-            if (!(emit->scope->scope_flags & MP_SCOPE_FLAG_GENERATOR)) {
+            if (!(emit->scope->scope_flags & MP_SCOPE_FLAG_GENERATOR) && !NEED_BYTECODE_SEMANTICS(emit)) {
                 // Optimisation: if globals didn't change don't push the nlr context
                 ASM_JUMP_IF_REG_ZERO(emit->as, REG_RET, start_label, false);
             }
@@ -1214,6 +1253,10 @@ static void emit_native_global_exc_entry(emit_t *emit) {
             emit_call(emit, MP_F_SETJMP);
             #endif
             ASM_JUMP_IF_REG_ZERO(emit->as, REG_RET, start_label, true);
+
+            if (NEED_BYTECODE_SEMANTICS(emit)) {
+                emit_native_add_traceback(emit);
+            }
         } else {
             // Clear the unwind state
             ASM_XOR_REG_REG(emit->as, REG_TEMP0, REG_TEMP0);
@@ -1239,6 +1282,9 @@ static void emit_native_global_exc_entry(emit_t *emit) {
 
             // Global exception handler: check for valid exception handler
             emit_native_label_assign(emit, global_except_label);
+            if (NEED_BYTECODE_SEMANTICS(emit)) {
+                emit_native_add_traceback(emit);
+            }
             ASM_MOV_REG_LOCAL(emit->as, REG_LOCAL_1, LOCAL_IDX_EXC_HANDLER_PC(emit));
             ASM_JUMP_IF_REG_NONZERO(emit->as, REG_LOCAL_1, nlr_label, false);
         }
@@ -1290,7 +1336,7 @@ static void emit_native_global_exc_exit(emit_t *emit) {
         if (!(emit->scope->scope_flags & MP_SCOPE_FLAG_GENERATOR)) {
             emit_native_mov_reg_state(emit, REG_ARG_1, LOCAL_IDX_OLD_GLOBALS(emit));
 
-            if (emit->scope->exc_stack_size == 0) {
+            if (emit->scope->exc_stack_size == 0 && !NEED_BYTECODE_SEMANTICS(emit)) {
                 // Optimisation: if globals didn't change then don't restore them and don't do nlr_pop
                 ASM_JUMP_IF_REG_ZERO(emit->as, REG_ARG_1, emit->exit_label + 1, false);
             }
@@ -1303,7 +1349,7 @@ static void emit_native_global_exc_exit(emit_t *emit) {
         emit_call(emit, MP_F_NLR_POP);
 
         if (!(emit->scope->scope_flags & MP_SCOPE_FLAG_GENERATOR)) {
-            if (emit->scope->exc_stack_size == 0) {
+            if (emit->scope->exc_stack_size == 0 && !NEED_BYTECODE_SEMANTICS(emit)) {
                 // Destination label for above optimisation
                 emit_native_label_assign(emit, emit->exit_label + 1);
             }
@@ -1314,6 +1360,12 @@ static void emit_native_global_exc_exit(emit_t *emit) {
     }
 
     ASM_EXIT(emit->as);
+
+    if (emit->need_unbound_stub) {
+        // Checks for unbound locals jump here, see emit_native_load_local
+        mp_asm_base_label_assign(&emit->as->base, emit->unbound_label);
+        ASM_CALL_IND(emit->as, MP_F_NATIVE_UNBOUND_LOCAL);
+    }
 }
 
 static void emit_native_import_name(emit_t *emit, qstr qst) {
@@ -1441,12 +1493,30 @@ static void emit_native_load_deref(emit_t *emit, qstr qst, mp_uint_t local_num)
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
+// Whether a local is known to be bound without checking it at runtime: either a
+// closed-over variable loaded as its cell, or a parameter that is never deleted
+static bool emit_native_local_is_bound(emit_t *emit, qstr qst, int kind) {
+    id_info_t *id = scope_find(emit->scope, qst);
+    if (id == NULL) {
+        return false;
+    }
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST && (id->kind == ID_INFO_KIND_CELL || id->kind == ID_INFO_KIND_FREE)) {
+        return true;
+    }
+    return id->kind == ID_INFO_KIND_LOCAL && (id->flags & (ID_FLAG_IS_PARAM | ID_FLAG_IS_DELETED)) == ID_FLAG_IS_PARAM;
+}
+
 static void emit_native_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind) {
     if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
         emit_native_load_fast(emit, qst, local_num);
     } else {
         emit_native_load_deref(emit, qst, local_num);
     }
+    if (NEED_BYTECODE_SEMANTICS(emit) && !emit_native_local_is_bound(emit, qst, kind)) {
+        // An unbound local holds MP_OBJ_NULL, so jump to a stub that raises NameError
+        ASM_JUMP_IF_REG_ZERO(emit->as, peek_stack(emit, 0)->data.u_reg, emit->unbound_label, false);
+        emit->need_unbound_stub = true;
+    }
 }
 
 static void emit_native_load_global(emit_t *emit, qstr qst, int kind) {
@@ -1903,7 +1973,13 @@ static void emit_native_store_subscr(emit_t *emit) {
 }
 
 static void emit_native_delete_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind) {
-    if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
+    if (NEED_BYTECODE_SEMANTICS(emit)) {
+        // Check the local is bound, then unbind it so later loads raise NameError
+        emit_native_load_local(emit, qst, local_num, kind);
+        emit_pre_pop_discard(emit);
+        emit_native_load_null(emit);
+        emit_native_store_local(emit, qst, local_num, kind);
+    } else if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
         // TODO: This is not compliant implementation. We could use MP_OBJ_SENTINEL
         // to mark deleted vars but then every var would need to be checked on
         // each access. Very inefficient, so just set value to None to enable GC.
@@ -2006,10 +2082,22 @@ static void emit_native_jump(emit_t *emit, mp_uint_t label) {
 static void emit_native_jump_helper(emit_t *emit, bool cond, mp_uint_t label, bool pop) {
     vtype_kind_t vtype = peek_vtype(emit, 0);
     if (vtype == VTYPE_PYOBJ) {
+        #if MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH
+        // settle first because True/False branch before the call below
+        need_stack_settled(emit);
+        #endif
         emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
         if (!pop) {
             adjust_stack(emit, 1);
         }
+        #if MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH
+        // Comparisons usually produce True/False, so test for those before calling
+        // mp_obj_is_true.  Uses 2 labels reserved by the compiler.
+        emit_native_mov_reg_const(emit, REG_ARG_2, cond ? MP_F_CONST_TRUE_OBJ : MP_F_CONST_FALSE_OBJ);
+        ASM_JUMP_IF_REG_EQ(emit->as, REG_ARG_1, REG_ARG_2, *emit->label_slot);
+        emit_native_mov_reg_const(emit, REG_ARG_2, cond ? MP_F_CONST_FALSE_OBJ : MP_F_CONST_TRUE_OBJ);
+        ASM_JUMP_IF_REG_EQ(emit->as, REG_ARG_1, REG_ARG_2, *emit->label_slot + 1);
+        #endif
         emit_call(emit, MP_F_OBJ_IS_TRUE);
     } else {
         emit_pre_pop_reg(emit, &vtype, REG_RET);
@@ -2034,6 +2122,14 @@ static void emit_native_jump_helper(emit_t *emit, bool cond, mp_uint_t label, bo
     } else {
         ASM_JUMP_IF_REG_ZERO(emit->as, REG_RET, label, vtype == VTYPE_PYOBJ);
     }
+    #if MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH
+    if (vtype == VTYPE_PYOBJ) {
+        ASM_JUMP(emit->as, *emit->label_slot + 1);
+        mp_asm_base_label_assign(&emit->as->base, *emit->label_slot);
+        ASM_JUMP(emit->as, label);
+        mp_asm_base_label_assign(&emit->as->base, *emit->label_slot + 1);
+    }
+    #endif
     if (!pop) {
         adjust_stack(emit, -1);
     }
@@ -2169,6 +2265,9 @@ static void emit_native_with_cleanup(emit_t *emit, mp_uint_t label) {
     // nlr_catch
     // Don't use emit_native_label_assign because this isn't a real finally label
     mp_asm_base_label_assign(&emit->as->base, label);
+    if (NEED_BYTECODE_SEMANTICS(emit) && emit->source_line != 0) {
+        emit_native_store_source_line(emit, emit->source_line);
+    }
 
     // Leave with's exception handler
     emit_native_leave_exc_stack(emit, true);
@@ -2218,8 +2317,15 @@ static void emit_native_end_finally(emit_t *emit) {
     //   else: raise exc
     // the check if exc is None is done in the MP_F_NATIVE_RAISE stub
     emit_native_pre(emit);
+    if (NEED_BYTECODE_SEMANTICS(emit)) {
+        // Like the VM, don't add another traceback entry for an exception re-raised here
+        emit_native_store_source_line(emit, 0);
+    }
     ASM_MOV_REG_LOCAL(emit->as, REG_ARG_1, LOCAL_IDX_EXC_VAL(emit));
     emit_call(emit, MP_F_NATIVE_RAISE);
+    if (NEED_BYTECODE_SEMANTICS(emit)) {
+        emit_native_store_source_line(emit, emit->source_line);
+    }
 
     // Get state for this finally and see if we need to unwind
     exc_stack_entry_t *e = emit_native_pop_exc_stack(emit);
@@ -2324,6 +2430,224 @@ static void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     }
 }
 
+// Sets REG_RET to 1 if (REG_ARG_2 op reg_rhs) holds and to 0 otherwise, where op_idx
+// selects the comparison: op - MP_BINARY_OP_LESS, plus 6 for a signed comparison.
+static void emit_native_setcc(emit_t *emit, size_t op_idx, int reg_rhs) {
+    #if N_X64
+    asm_x64_xor_r64_r64(emit->as, REG_RET, REG_RET);
+    asm_x64_cmp_r64_with_r64(emit->as, reg_rhs, REG_ARG_2);
+    static byte ops[6 + 6] = {
+        // unsigned
+        ASM_X64_CC_JB,
+        ASM_X64_CC_JA,
+        ASM_X64_CC_JE,
+        ASM_X64_CC_JBE,
+        ASM_X64_CC_JAE,
+        ASM_X64_CC_JNE,
+        // signed
+        ASM_X64_CC_JL,
+        ASM_X64_CC_JG,
+        ASM_X64_CC_JE,
+        ASM_X64_CC_JLE,
+        ASM_X64_CC_JGE,
+        ASM_X64_CC_JNE,
+    };
+    asm_x64_setcc_r8(emit->as, ops[op_idx], REG_RET);
+    #elif N_X86
+    asm_x86_xor_r32_r32(emit->as, REG_RET, REG_RET);
+    asm_x86_cmp_r32_with_r32(emit->as, reg_rhs, REG_ARG_2);
+    static byte ops[6 + 6] = {
+        // unsigned
+        ASM_X86_CC_JB,
+        ASM_X86_CC_JA,
+        ASM_X86_CC_JE,
+        ASM_X86_CC_JBE,
+        ASM_X86_CC_JAE,
+        ASM_X86_CC_JNE,
+        // signed
+        ASM_X86_CC_JL,
+        ASM_X86_CC_JG,
+        ASM_X86_CC_JE,
+        ASM_X86_CC_JLE,
+        ASM_X86_CC_JGE,
+        ASM_X86_CC_JNE,
+    };
+    asm_x86_setcc_r8(emit->as, ops[op_idx], REG_RET);
+    #elif N_THUMB
+    asm_thumb_cmp_rlo_rlo(emit->as, REG_ARG_2, reg_rhs);
+    if (asm_thumb_allow_armv7m(emit->as)) {
+        static uint16_t ops[6 + 6] = {
+            // unsigned
+            ASM_THUMB_OP_ITE_CC,
+            ASM_THUMB_OP_ITE_HI,
+            ASM_THUMB_OP_ITE_EQ,
+            ASM_THUMB_OP_ITE_LS,
+            ASM_THUMB_OP_ITE_CS,
+            ASM_THUMB_OP_ITE_NE,
+            // signed
+            ASM_THUMB_OP_ITE_LT,
+            ASM_THUMB_OP_ITE_GT,
+            ASM_THUMB_OP_ITE_EQ,
+            ASM_THUMB_OP_ITE_LE,
+            ASM_THUMB_OP_ITE_GE,
+            ASM_THUMB_OP_ITE_NE,
+        };
+        asm_thumb_op16(emit->as, ops[op_idx]);
+        asm_thumb_mov_rlo_i8(emit->as, REG_RET, 1);
+        asm_thumb_mov_rlo_i8(emit->as, REG_RET, 0);
+    } else {
+        static uint16_t ops[6 + 6] = {
+            // unsigned
+            ASM_THUMB_CC_CC,
+            ASM_THUMB_CC_HI,
+            ASM_THUMB_CC_EQ,
+            ASM_THUMB_CC_LS,
+            ASM_THUMB_CC_CS,
+            ASM_THUMB_CC_NE,
+            // signed
+            ASM_THUMB_CC_LT,
+            ASM_THUMB_CC_GT,
+            ASM_THUMB_CC_EQ,
+            ASM_THUMB_CC_LE,
+            ASM_THUMB_CC_GE,
+            ASM_THUMB_CC_NE,
+        };
+        asm_thumb_bcc_rel9(emit->as, ops[op_idx], 6);
+        asm_thumb_mov_rlo_i8(emit->as, REG_RET, 0);
+        asm_thumb_b_rel12(emit->as, 4);
+        asm_thumb_mov_rlo_i8(emit->as, REG_RET, 1);
+    }
+    #elif N_ARM
+    asm_arm_cmp_reg_reg(emit->as, REG_ARG_2, reg_rhs);
+    static uint ccs[6 + 6] = {
+        // unsigned
+        ASM_ARM_CC_CC,
+        ASM_ARM_CC_HI,
+        ASM_ARM_CC_EQ,
+        ASM_ARM_CC_LS,
+        ASM_ARM_CC_CS,
+        ASM_ARM_CC_NE,
+        // signed
+        ASM_ARM_CC_LT,
+        ASM_ARM_CC_GT,
+        ASM_ARM_CC_EQ,
+        ASM_ARM_CC_LE,
+        ASM_ARM_CC_GE,
+        ASM_ARM_CC_NE,
+    };
+    asm_arm_setcc_reg(emit->as, REG_RET, ccs[op_idx]);
+    #elif N_XTENSA || N_XTENSAWIN
+    static uint8_t ccs[6 + 6] = {
+        // unsigned
+        ASM_XTENSA_CC_LTU,
+        0x80 | ASM_XTENSA_CC_LTU, // for GTU we'll swap args
+        ASM_XTENSA_CC_EQ,
+        0x80 | ASM_XTENSA_CC_GEU, // for LEU we'll swap args
+        ASM_XTENSA_CC_GEU,
+        ASM_XTENSA_CC_NE,
+        // signed
+        ASM_XTENSA_CC_LT,
+        0x80 | ASM_XTENSA_CC_LT, // for GT we'll swap args
+        ASM_XTENSA_CC_EQ,
+        0x80 | ASM_XTENSA_CC_GE, // for LE we'll swap args
+        ASM_XTENSA_CC_GE,
+        ASM_XTENSA_CC_NE,
+    };
+    uint8_t cc = ccs[op_idx];
+    if ((cc & 0x80) == 0) {
+        asm_xtensa_setcc_reg_reg_reg(emit->as, cc, REG_RET, REG_ARG_2, reg_rhs);
+    } else {
+        asm_xtensa_setcc_reg_reg_reg(emit->as, cc & ~0x80, REG_RET, reg_rhs, REG_ARG_2);
+    }
+    #else
+    #error not implemented
+    #endif
+}
+
+#if MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH
+// Emits an inline fast path for add, subtract and comparisons of two objects that
+// turn out to be small ints at runtime, with a call to mp_binary_op for everything
+// else (including results that don't fit in a small int).  Returns false, emitting
+// nothing, if op has no fast path.  Uses 2 labels reserved by the compiler.
+static bool emit_native_binary_op_small_int(emit_t *emit, mp_binary_op_t op) {
+    mp_binary_op_t fast_op = op;
+    if (fast_op == MP_BINARY_OP_INPLACE_ADD || fast_op == MP_BINARY_OP_INPLACE_SUBTRACT) {
+        fast_op += MP_BINARY_OP_ADD - MP_BINARY_OP_INPLACE_ADD;
+    }
+    if (!(fast_op == MP_BINARY_OP_ADD || fast_op == MP_BINARY_OP_SUBTRACT
+          || (MP_BINARY_OP_LESS <= fast_op && fast_op <= MP_BINARY_OP_NOT_EQUAL))) {
+        return false;
+    }
+
+    // A small-int constant (eg the 1 in "i + 1") doesn't need its tag checked.
+    bool lhs_known = peek_stack(emit, 1)->kind == STACK_IMM && peek_stack(emit, 1)->vtype == VTYPE_INT;
+    bool rhs_known = peek_stack(emit, 0)->kind == STACK_IMM && peek_stack(emit, 0)->vtype == VTYPE_INT;
+
+    // Both operands stay in the Python stack so the slow path can reload them.
+    need_stack_settled(emit);
+    int local_lhs = emit->stack_start + emit->stack_size - 2;
+    int local_rhs = local_lhs + 1;
+    mp_uint_t label_slow = *emit->label_slot;
+    mp_uint_t label_done = *emit->label_slot + 1;
+    emit_native_mov_reg_state(emit, REG_ARG_2, local_lhs);
+    emit_native_mov_reg_state(emit, REG_ARG_3, local_rhs);
+
+    // Guard: both operands must have the small-int tag bit set; leaves 1 in REG_RET.
+    ASM_MOV_REG_IMM(emit->as, REG_RET, 1);
+    if (!(lhs_known && rhs_known)) {
+        if (!lhs_known) {
+            ASM_AND_REG_REG(emit->as, REG_RET, REG_ARG_2);
+        }
+        if (!rhs_known) {
+            ASM_AND_REG_REG(emit->as, REG_RET, REG_ARG_3);
+        }
+        ASM_JUMP_IF_REG_ZERO(emit->as, REG_RET, label_slow, false);
+    }
+
+    if (fast_op != MP_BINARY_OP_ADD && fast_op != MP_BINARY_OP_SUBTRACT) {
+        // Tagged small ints compare the same way as their values.
+        emit_native_setcc(emit, fast_op - MP_BINARY_OP_LESS + 6, REG_ARG_3);
+        // Turn 0/1 into mp_const_false/mp_const_true, which are adjacent in the fun table.
+        for (int n = 1; n < ASM_WORD_SIZE; n <<= 1) {
+            ASM_ADD_REG_REG(emit->as, REG_RET, REG_RET);
+        }
+        ASM_ADD_REG_REG(emit->as, REG_RET, REG_FUN_TABLE);
+        ASM_LOAD_REG_REG_OFFSET(emit->as, REG_RET, REG_RET, MP_F_CONST_FALSE_OBJ);
+    } else {
+        // Work with d = rhs - 1 (rhs value shifted, tag cleared) so that lhs + d and
+        // lhs - d are the tagged result, then check the sign bit for overflow.
+        ASM_SUB_REG_REG(emit->as, REG_ARG_3, REG_RET);
+        ASM_MOV_REG_REG(emit->as, REG_RET, REG_ARG_2);
+        if (fast_op == MP_BINARY_OP_ADD) {
+            // overflow iff ((lhs ^ r) & (d ^ r)) < 0
+            ASM_ADD_REG_REG(emit->as, REG_RET, REG_ARG_3);
+            ASM_XOR_REG_REG(emit->as, REG_ARG_2, REG_RET);
+            ASM_XOR_REG_REG(emit->as, REG_ARG_3, REG_RET);
+        } else {
+            // overflow iff ((lhs ^ d) & (lhs ^ r)) < 0
+            ASM_SUB_REG_REG(emit->as, REG_RET, REG_ARG_3);
+            ASM_XOR_REG_REG(emit->as, REG_ARG_3, REG_ARG_2);
+            ASM_XOR_REG_REG(emit->as, REG_ARG_2, REG_RET);
+        }
+        ASM_AND_REG_REG(emit->as, REG_ARG_2, REG_ARG_3);
+        ASM_MOV_REG_IMM(emit->as, REG_ARG_3, 0);
+        ASM_JUMP_IF_REG_LT(emit->as, REG_ARG_2, REG_ARG_3, label_slow);
+    }
+    ASM_JUMP(emit->as, label_done);
+
+    mp_asm_base_label_assign(&emit->as->base, label_slow);
+    emit_native_mov_reg_state(emit, REG_ARG_2, local_lhs);
+    emit_native_mov_reg_state(emit, REG_ARG_3, local_rhs);
+    emit_call_with_imm_arg(emit, MP_F_BINARY_OP, op, REG_ARG_1);
+    mp_asm_base_label_assign(&emit->as->base, label_done);
+
+    emit_pre_pop_discard(emit);
+    emit_pre_pop_discard(emit);
+    emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
+    return true;
+}
+#endif
+
 static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
     DEBUG_printf("binary_op(" UINT_FMT ")\n", op);
     vtype_kind_t vtype_lhs = peek_vtype(emit, 1);
@@ -2426,135 +2750,7 @@ static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
             size_t op_idx = op - MP_BINARY_OP_LESS + (vtype_lhs == VTYPE_UINT ? 0 : 6);
 
             need_reg_single(emit, REG_RET, 0);
-            #if N_X64
-            asm_x64_xor_r64_r64(emit->as, REG_RET, REG_RET);
-            asm_x64_cmp_r64_with_r64(emit->as, reg_rhs, REG_ARG_2);
-            static byte ops[6 + 6] = {
-                // unsigned
-                ASM_X64_CC_JB,
-                ASM_X64_CC_JA,
-                ASM_X64_CC_JE,
-                ASM_X64_CC_JBE,
-                ASM_X64_CC_JAE,
-                ASM_X64_CC_JNE,
-                // signed
-                ASM_X64_CC_JL,
-                ASM_X64_CC_JG,
-                ASM_X64_CC_JE,
-                ASM_X64_CC_JLE,
-                ASM_X64_CC_JGE,
-                ASM_X64_CC_JNE,
-            };
-            asm_x64_setcc_r8(emit->as, ops[op_idx], REG_RET);
-            #elif N_X86
-            asm_x86_xor_r32_r32(emit->as, REG_RET, REG_RET);
-            asm_x86_cmp_r32_with_r32(emit->as, reg_rhs, REG_ARG_2);
-            static byte ops[6 + 6] = {
-                // unsigned
-                ASM_X86_CC_JB,
-                ASM_X86_CC_JA,
-                ASM_X86_CC_JE,
-                ASM_X86_CC_JBE,
-                ASM_X86_CC_JAE,
-                ASM_X86_CC_JNE,
-                // signed
-                ASM_X86_CC_JL,
-                ASM_X86_CC_JG,
-                ASM_X86_CC_JE,
-                ASM_X86_CC_JLE,
-                ASM_X86_CC_JGE,
-                ASM_X86_CC_JNE,
-            };
-            asm_x86_setcc_r8(emit->as, ops[op_idx], REG_RET);
-            #elif N_THUMB
-            asm_thumb_cmp_rlo_rlo(emit->as, REG_ARG_2, reg_rhs);
-            if (asm_thumb_allow_armv7m(emit->as)) {
-                static uint16_t ops[6 + 6] = {
-                    // unsigned
-                    ASM_THUMB_OP_ITE_CC,
-                    ASM_THUMB_OP_ITE_HI,
-                    ASM_THUMB_OP_ITE_EQ,
-                    ASM_THUMB_OP_ITE_LS,
-                    ASM_THUMB_OP_ITE_CS,
-                    ASM_THUMB_OP_ITE_NE,
-                    // signed
-                    ASM_THUMB_OP_ITE_LT,
-                    ASM_THUMB_OP_ITE_GT,
-                    ASM_THUMB_OP_ITE_EQ,
-                    ASM_THUMB_OP_ITE_LE,
-                    ASM_THUMB_OP_ITE_GE,
-                    ASM_THUMB_OP_ITE_NE,
-                };
-                asm_thumb_op16(emit->as, ops[op_idx]);
-                asm_thumb_mov_rlo_i8(emit->as, REG_RET, 1);
-                asm_thumb_mov_rlo_i8(emit->as, REG_RET, 0);
-            } else {
-                static uint16_t ops[6 + 6] = {
-                    // unsigned
-                    ASM_THUMB_CC_CC,
-                    ASM_THUMB_CC_HI,
-                    ASM_THUMB_CC_EQ,
-                    ASM_THUMB_CC_LS,
-                    ASM_THUMB_CC_CS,
-                    ASM_THUMB_CC_NE,
-                    // signed
-                    ASM_THUMB_CC_LT,
-                    ASM_THUMB_CC_GT,
-                    ASM_THUMB_CC_EQ,
-                    ASM_THUMB_CC_LE,
-                    ASM_THUMB_CC_GE,
-                    ASM_THUMB_CC_NE,
-                };
-                asm_thumb_bcc_rel9(emit->as, ops[op_idx], 6);
-                asm_thumb_mov_rlo_i8(emit->as, REG_RET, 0);
-                asm_thumb_b_rel12(emit->as, 4);
-                asm_thumb_mov_rlo_i8(emit->as, REG_RET, 1);
-            }
-            #elif N_ARM
-            asm_arm_cmp_reg_reg(emit->as, REG_ARG_2, reg_rhs);
-            static uint ccs[6 + 6] = {
-                // unsigned
-                ASM_ARM_CC_CC,
-                ASM_ARM_CC_HI,
-                ASM_ARM_CC_EQ,
-                ASM_ARM_CC_LS,
-                ASM_ARM_CC_CS,
-                ASM_ARM_CC_NE,
-                // signed
-                ASM_ARM_CC_LT,
-                ASM_ARM_CC_GT,
-                ASM_ARM_CC_EQ,
-                ASM_ARM_CC_LE,
-                ASM_ARM_CC_GE,
-                ASM_ARM_CC_NE,
-            };
-            asm_arm_setcc_reg(emit->as, REG_RET, ccs[op_idx]);
-            #elif N_XTENSA || N_XTENSAWIN
-            static uint8_t ccs[6 + 6] = {
-                // unsigned
-                ASM_XTENSA_CC_LTU,
-                0x80 | ASM_XTENSA_CC_LTU, // for GTU we'll swap args
-                ASM_XTENSA_CC_EQ,
-                0x80 | ASM_XTENSA_CC_GEU, // for LEU we'll swap args
-                ASM_XTENSA_CC_GEU,
-                ASM_XTENSA_CC_NE,
-                // signed
-                ASM_XTENSA_CC_LT,
-                0x80 | ASM_XTENSA_CC_LT, // for GT we'll swap args
-                ASM_XTENSA_CC_EQ,
-                0x80 | ASM_XTENSA_CC_GE, // for LE we'll swap args
-                ASM_XTENSA_CC_GE,
-                ASM_XTENSA_CC_NE,
-            };
-            uint8_t cc = ccs[op_idx];
-            if ((cc & 0x80) == 0) {
-                asm_xtensa_setcc_reg_reg_reg(emit->as, cc, REG_RET, REG_ARG_2, reg_rhs);
-            } else {
-                asm_xtensa_setcc_reg_reg_reg(emit->as, cc & ~0x80, REG_RET, reg_rhs, REG_ARG_2);
-            }
-            #else
-            #error not implemented
-            #endif
+            emit_native_setcc(emit, op_idx, reg_rhs);
             emit_post_push_reg(emit, VTYPE_BOOL, REG_RET);
         } else {
             // TODO other ops not yet implemented
@@ -2563,6 +2759,11 @@ static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
                 MP_ERROR_TEXT("binary op %q not implemented"), mp_binary_op_method_name[op]);
         }
     } else if (vtype_lhs == VTYPE_PYOBJ && vtype_rhs == VTYPE_PYOBJ) {
+        #if MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH
+        if (emit_native_binary_op_small_int(emit, op)) {
+            return;
+        }
+        #endif
         emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
         bool invert = false;
         if (op == MP_BINARY_OP_NOT_IN) {
@@ -2858,8 +3059,10 @@ static void emit_native_return_value(emit_t *emit) {
 }
 
 static void emit_native_raise_varargs(emit_t *emit, mp_uint_t n_args) {
-    (void)n_args;
-    assert(n_args == 1);
+    if (n_args != 1) {
+        // a bare re-raise and "raise ... from ..." are not supported
+        mp_raise_NotImplementedError(MP_ERROR_TEXT("native raise"));
+    }
     vtype_kind_t vtype_exc;
     emit_pre_pop_reg(emit, &vtype_exc, REG_ARG_1); // arg1 = object to raise
     if (vtype_exc != VTYPE_PYOBJ) {
@@ -36,6 +36,10 @@
 #include <valgrind/memcheck.h>
 #endif
 
+#if MICROPY_GC_PAUSE_STATS
+#include "py/mphal.h"
+#endif
+
 // CIRCUITPY-CHANGE
 #include "supervisor/shared/safe_mode.h"
 
@@ -143,6 +147,106 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #pragma GCC pop_options
 #endif
 
+#if MICROPY_GC_PAUSE_STATS
+static void gc_pause_end(void) {
+    mp_uint_t elapsed = MICROPY_GC_TICKS_US() - MP_STATE_MEM(gc_pause_start);
+    MP_STATE_MEM(gc_pause_last_us) = elapsed;
+    if (elapsed > MP_STATE_MEM(gc_pause_max_us)) {
+        MP_STATE_MEM(gc_pause_max_us) = elapsed;
+    }
+    MP_STATE_MEM(gc_pause_count)++;
+}
+#endif
+
+#if MICROPY_GC_SIZE_CLASSES
+// Size class of a free run of n_blocks: floor(log2(n_blocks)), capped at the
+// last class.
+static size_t gc_size_class(size_t n_blocks) {
+    size_t c = 0;
+    while (n_blocks > 1 && c < MICROPY_GC_SIZE_CLASSES - 1) {
+        n_blocks >>= 1;
+        c++;
+    }
+    return c;
+}
+
+// Remember a free run.  If the class is full the run is dropped; it can still
+// be found by the linear scan of the allocation table.
+static void gc_free_run_push(mp_state_mem_area_t *area, size_t block, size_t n_blocks) {
+    // gc_free_run_count is a uint8_t.
+    MP_STATIC_ASSERT(MICROPY_GC_SIZE_CLASS_DEPTH <= UINT8_MAX);
+    size_t c = gc_size_class(n_blocks);
+    size_t n = area->gc_free_run_count[c];
+    if (n < MICROPY_GC_SIZE_CLASS_DEPTH) {
+        area->gc_free_run_block[c][n] = block;
+        area->gc_free_run_len[c][n] = n_blocks;
+        area->gc_free_run_count[c] = n + 1;
+    }
+}
+
+static void gc_free_run_remove(mp_state_mem_area_t *area, size_t c, size_t idx) {
+    size_t last = --area->gc_free_run_count[c];
+    area->gc_free_run_block[c][idx] = area->gc_free_run_block[c][last];
+    area->gc_free_run_len[c][idx] = area->gc_free_run_len[c][last];
+}
+
+// Take n_blocks free blocks from the index.  Returns the first block, or
+// (size_t)-1 if no indexed run can hold the request.  The caller marks the
+// blocks as used.
+static size_t gc_free_run_take(mp_state_mem_area_t *area, size_t n_blocks) {
+    size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    size_t c = gc_size_class(n_blocks);
+    // Runs in the class of n_blocks may be too short, so take the first one
+    // that is long enough (first fit); runs in higher classes always are.
+    for (bool exact_class = true; c < MICROPY_GC_SIZE_CLASSES; c++, exact_class = false) {
+        size_t idx = area->gc_free_run_count[c];
+        while (idx-- > 0) {
+            size_t run_len = area->gc_free_run_len[c][idx];
+            if (exact_class && run_len < n_blocks) {
+                continue;
+            }
+            size_t block = area->gc_free_run_block[c][idx];
+            gc_free_run_remove(area, c, idx);
+
+            // The run may have been partly used since it was indexed.
+            size_t n_free = 0;
+            while (n_free < n_blocks && block + n_free < max_block && ATB_GET_KIND(area, block + n_free) == AT_FREE) {
+                n_free++;
+            }
+            if (n_free < n_blocks) {
+                // Stale entry; keep the free prefix if it moves to a lower class.
+                if (n_free > 0 && gc_size_class(n_free) < c) {
+                    gc_free_run_push(area, block, n_free);
+                }
+                // The removal moved another entry into idx; re-examine it.
+                idx = MIN(idx + 1, area->gc_free_run_count[c]);
+                continue;
+            }
+            if (run_len > n_blocks) {
+                gc_free_run_push(area, block + n_blocks, run_len - n_blocks);
+            }
+            return block;
+        }
+    }
+    return (size_t)-1;
+}
+
+// Reverse each class so the lowest-addressed runs (pushed first by the sweep)
+// are handed out first, which keeps the heap compact.
+static void gc_free_run_reverse(mp_state_mem_area_t *area) {
+    for (size_t c = 0; c < MICROPY_GC_SIZE_CLASSES; c++) {
+        for (size_t lo = 0, hi = area->gc_free_run_count[c]; lo + 1 < hi; lo++, hi--) {
+            size_t block = area->gc_free_run_block[c][lo];
+            size_t run_len = area->gc_free_run_len[c][lo];
+            area->gc_free_run_block[c][lo] = area->gc_free_run_block[c][hi - 1];
+            area->gc_free_run_len[c][lo] = area->gc_free_run_len[c][hi - 1];
+            area->gc_free_run_block[c][hi - 1] = block;
+            area->gc_free_run_len[c][hi - 1] = run_len;
+        }
+    }
+}
+#endif
+
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // calculate parameters for GC (T=total, A=alloc table, F=finaliser table, P=pool; all in bytes):
@@ -189,6 +293,12 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
 
+    #if MICROPY_GC_SIZE_CLASSES
+    // the whole pool is a single free run
+    memset(area->gc_free_run_count, 0, sizeof(area->gc_free_run_count));
+    gc_free_run_push(area, 0, gc_pool_block_len);
+    #endif
+
     #if MICROPY_GC_SPLIT_HEAP
     area->next = NULL;
     #endif
@@ -233,6 +343,12 @@ void gc_init(void *start, void *end) {
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
 
+    #if MICROPY_GC_PAUSE_STATS
+    MP_STATE_MEM(gc_pause_last_us) = 0;
+    MP_STATE_MEM(gc_pause_max_us) = 0;
+    MP_STATE_MEM(gc_pause_count) = 0;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     mp_thread_mutex_init(&MP_STATE_MEM(gc_mutex));
     #endif
@@ -537,6 +653,13 @@ static void gc_sweep(void) {
 
         size_t last_used_block = 0;
 
+        #if MICROPY_GC_SIZE_CLASSES
+        // rebuild the free run index while sweeping
+        memset(area->gc_free_run_count, 0, sizeof(area->gc_free_run_count));
+        size_t run_start = 0;
+        size_t run_len = 0;
+        #endif
+
         for (size_t block = 0; block < end_block; block++) {
             MICROPY_GC_HOOK_LOOP(block);
             switch (ATB_GET_KIND(area, block)) {
@@ -588,7 +711,31 @@ static void gc_sweep(void) {
                     last_used_block = block;
                     break;
             }
+
+            #if MICROPY_GC_SIZE_CLASSES
+            if (ATB_GET_KIND(area, block) == AT_FREE) {
+                if (run_len++ == 0) {
+                    run_start = block;
+                }
+            } else if (run_len > 0) {
+                gc_free_run_push(area, run_start, run_len);
+                run_len = 0;
+            }
+            #endif
+        }
+
+        #if MICROPY_GC_SIZE_CLASSES
+        // everything past end_block is free
+        size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        if (run_len == 0) {
+            run_start = end_block;
+        }
+        run_len += total_blocks - end_block;
+        if (run_len > 0) {
+            gc_free_run_push(area, run_start, run_len);
         }
+        gc_free_run_reverse(area);
+        #endif
 
         area->gc_last_used_block = last_used_block;
 
@@ -612,6 +759,9 @@ void gc_collect_start(void) {
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_GC_PAUSE_STATS
+    MP_STATE_MEM(gc_pause_start) = MICROPY_GC_TICKS_US();
+    #endif
 
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
@@ -689,6 +839,9 @@ void gc_collect_end(void) {
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         area->gc_last_free_atb_index = 0;
     }
+    #if MICROPY_GC_PAUSE_STATS
+    gc_pause_end();
+    #endif
     MP_STATE_THREAD(gc_lock_depth)--;
     GC_EXIT();
 }
@@ -697,6 +850,9 @@ void gc_sweep_all(void) {
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_GC_PAUSE_STATS
+    MP_STATE_MEM(gc_pause_start) = MICROPY_GC_TICKS_US();
+    #endif
     gc_collect_end();
 }
 
@@ -802,6 +958,9 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     size_t start_block;
     size_t n_free;
     int collected = !MP_STATE_MEM(gc_auto_collect_enabled);
+    #if MICROPY_GC_SIZE_CLASSES
+    bool from_index = false;
+    #endif
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
     #endif
@@ -828,6 +987,20 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             reset_into_safe_mode(SAFE_MODE_GC_ALLOC_OUTSIDE_VM);
         }
 
+        #if MICROPY_GC_SIZE_CLASSES
+        // try the free run index before scanning the allocation table
+        for (mp_state_mem_area_t *idx_area = &MP_STATE_MEM(area); idx_area != NULL; idx_area = NEXT_AREA(idx_area)) {
+            start_block = gc_free_run_take(idx_area, n_blocks);
+            if (start_block != (size_t)-1) {
+                area = idx_area;
+                i = start_block + n_blocks - 1;
+                n_free = n_blocks;
+                from_index = true;
+                goto found;
+            }
+        }
+        #endif
+
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
             n_free = 0;
@@ -884,8 +1057,13 @@ found:
     // next scan.  To reduce fragmentation, we only do this if we were looking
     // for a single free block, which guarantees that there are no free blocks
     // before this one.  Also, whenever we free or shink a block we must check
-    // if this index needs adjusting (see gc_realloc and gc_free).
+    // if this index needs adjusting (see gc_realloc and gc_free).  Runs taken
+    // from the free run index give no such guarantee.
+    #if MICROPY_GC_SIZE_CLASSES
+    if (n_free == 1 && !from_index) {
+    #else
     if (n_free == 1) {
+    #endif
         #if MICROPY_GC_SPLIT_HEAP
         MP_STATE_MEM(gc_last_free_area) = area;
         #endif
@@ -1033,12 +1211,20 @@ void gc_free(void *ptr) {
     gc_log_change(start_block, 0);
     #endif
 
+    #if MICROPY_GC_SIZE_CLASSES
+    size_t start_block = block;
+    #endif
+
     // free head and all of its tail blocks
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    #if MICROPY_GC_SIZE_CLASSES
+    gc_free_run_push(area, start_block, block - start_block);
+    #endif
+
     GC_EXIT();
 
     #if EXTENSIVE_HEAP_PROFILING
@@ -1181,6 +1367,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             ATB_ANY_TO_FREE(area, bl);
         }
 
+        #if MICROPY_GC_SIZE_CLASSES
+        gc_free_run_push(area, block + new_blocks, n_blocks - new_blocks);
+        #endif
+
         #if MICROPY_GC_SPLIT_HEAP
         if (MP_STATE_MEM(gc_last_free_area) != area) {
             // See comment in gc_free.
@@ -316,6 +316,31 @@ def compute_hash(qstr, bytes_hash):
     return (hash & ((1 << (8 * (bytes_hash or 2))) - 1)) or 1
 
 
+# this must match qstr_compute_full_hash in qstr.c
+def compute_full_hash(qstr):
+    hash = 5381
+    for b in qstr:
+        hash = ((hash * 33) ^ b) & 0xFFFFFFFF
+    return hash
+
+
+# Build an open-addressing hash index for a pool of qstrs, as probed by
+# qstr_find_strn: a power-of-two table at most half full, each slot holding
+# the 1-based position in the pool of a qstr (0 marks an empty slot).
+def make_hash_index(pool_qbytes):
+    size = 2
+    while size < 2 * len(pool_qbytes):
+        size *= 2
+    assert size <= 65536
+    index = [0] * size
+    for i, qbytes in enumerate(pool_qbytes):
+        slot = compute_full_hash(qbytes) & (size - 1)
+        while index[slot]:
+            slot = (slot + 1) & (size - 1)
+        index[slot] = i + 1
+    return index
+
+
 def qstr_escape(qst):
     def esc_char(m):
         c = ord(m.group(0))
@@ -429,6 +454,9 @@ def print_qstr_data(qcfgs, qstrs, translations):
     print("// This file was automatically generated by makeqstrdata.py")
     print("")
 
+    # qstr bytes of each const pool, for the hash indexes
+    pool_qbytes = ([b""], [])
+
     # add NULL qstr with no hash or data
     print('QDEF0(MP_QSTRnull, 0, 0, "")')
 
@@ -436,6 +464,7 @@ def print_qstr_data(qcfgs, qstrs, translations):
     for qstr in static_qstr_list:
         qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
         print("QDEF0(MP_QSTR_%s, %s)" % (qstr_escape(qstr), qbytes))
+        pool_qbytes[0].append(bytes_cons(qstr, "utf8"))
 
     # CIRCUITPY-CHANGE: track total qstr size
     total_qstr_size = 0
@@ -446,10 +475,20 @@ def print_qstr_data(qcfgs, qstrs, translations):
         qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
         pool = 0 if qstr in unsorted_qstr_list else 1
         print("QDEF%d(MP_QSTR_%s, %s)" % (pool, ident, qbytes))
+        pool_qbytes[pool].append(bytes_cons(qstr, "utf8"))
 
         # CIRCUITPY-CHANGE: track total qstr size
         total_qstr_size += len(qstr)
 
+    # hash indexes of the const pools, see qstr_find_strn
+    if int(qcfgs.get("HASH_INDEX", 0)):
+        print("#ifdef QINDEX0")
+        for pool in (0, 1):
+            index = make_hash_index(pool_qbytes[pool])
+            for i in range(0, len(index), 16):
+                print(" ".join("QINDEX%d(%d)" % (pool, x) for x in index[i : i + 16]))
+        print("#endif")
+
     # CIRCUITPY-CHANGE: translations
     print(
         "// Enumerate translated texts but don't actually include translations. Instead, the linker will link them in."
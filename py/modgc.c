@@ -100,6 +100,19 @@ static mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+#if MICROPY_GC_PAUSE_STATS
+// pause_info(): return (longest pause, last pause, number of collections)
+static mp_obj_t gc_pause_info(void) {
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_pause_max_us)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_pause_last_us)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_pause_count)),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_pause_info_obj, gc_pause_info);
+#endif
+
 static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
@@ -111,6 +124,9 @@ static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    #if MICROPY_GC_PAUSE_STATS
+    { MP_ROM_QSTR(MP_QSTR_pause_info), MP_ROM_PTR(&gc_pause_info_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
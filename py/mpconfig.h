@@ -311,6 +311,15 @@
 #endif
 #endif
 
+// Whether each qstr pool carries a hash index, so that looking up a string
+// costs a few probes per pool instead of a binary or linear search.  The
+// index of ROM pools is generated at build time; runtime pools fill theirs in
+// as qstrs are interned.  Costs 4 bytes of ROM per ROM qstr and 4 bytes of
+// RAM per runtime qstr slot.
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX (0)
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -593,12 +602,73 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// Whether the bytecode emitter fuses common opcode pairs into superinstructions
+// (see bc0.h).  Bytecode using them can't run on a VM without this option, so
+// it must not be enabled when compiling .mpy files, eg in mpy-cross.
+#ifndef MICROPY_OPT_BC_SUPERINSTRUCTIONS
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (0)
+#endif
+
+// Whether the VM rewrites generic binary ops in bytecode held in RAM into forms
+// specialised for small ints once they have seen small int arguments.
+#ifndef MICROPY_OPT_BC_QUICKEN
+#define MICROPY_OPT_BC_QUICKEN (0)
+#endif
+
+// Give each LOAD_ATTR, LOAD_METHOD and STORE_ATTR call site in the bytecode VM
+// an inline cache of where it last found its attribute, so monomorphic sites
+// on Python classes and instances skip mp_map_lookup.
+#ifndef MICROPY_OPT_ATTR_INLINE_CACHE
+#define MICROPY_OPT_ATTR_INLINE_CACHE (0)
+#endif
+
+// Number of inline cache entries; must be a power of 2.  Call sites share
+// entries by the low bits of their address.
+#ifndef MICROPY_OPT_ATTR_INLINE_CACHE_SIZE
+#define MICROPY_OPT_ATTR_INLINE_CACHE_SIZE (32)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// Whether to multiply large integers using Karatsuba's method rather than the
+// schoolbook method once both operands have at least
+// MICROPY_MPZ_KARATSUBA_THRESHOLD digits.  Needs temporary heap memory of about
+// twice the size of the product.  Increases Thumb2 code size by about 500 bytes.
+#ifndef MICROPY_OPT_MPZ_KARATSUBA
+#define MICROPY_OPT_MPZ_KARATSUBA (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// Number of digits (of MPZ_DIG_SIZE bits) at which Karatsuba multiplication
+// takes over from the schoolbook method; must be at least 8.
+#ifndef MICROPY_MPZ_KARATSUBA_THRESHOLD
+#define MICROPY_MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
+// Whether pow(a, b, c) with a large odd modulus uses Montgomery multiplication,
+// avoiding a long division after every multiply.  Increases Thumb2 code size by
+// about 400 bytes.
+#ifndef MICROPY_OPT_MPZ_MONTGOMERY
+#define MICROPY_OPT_MPZ_MONTGOMERY (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+
+// Whether substring search (str/bytes find, index, count, split, replace, in)
+// uses memchr for 1-byte needles and Boyer-Moore-Horspool for longer ones,
+// instead of comparing at every position.  Uses 256 bytes of stack per search.
+#ifndef MICROPY_OPT_FAST_STR_SEARCH
+#define MICROPY_OPT_FAST_STR_SEARCH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// Whether the native emitter inlines add, subtract and comparisons of two objects,
+// for when they are small ints at runtime, calling mp_binary_op only if they aren't
+// or the result overflows.  Needs small ints to be tagged with bit 0 set.
+#ifndef MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH
+#define MICROPY_OPT_NATIVE_SMALL_INT_FAST_PATH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES && (MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_A || MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C))
+#endif
 
 // Whether math.factorial is large, fast and recursive (1) or small and slow (0).
 #ifndef MICROPY_OPT_MATH_FACTORIAL
@@ -679,6 +749,30 @@
 #define MICROPY_GC_SPLIT_HEAP_AUTO (0)
 #endif
 
+// Number of size classes in the per-area index of free runs, used by gc_alloc
+// to find space without scanning the allocation table.  Class c holds runs of
+// 2**c to 2**(c+1)-1 blocks (the last class holds all longer runs).  The index
+// is rebuilt by each sweep.  Set to 0 to disable the index.
+#ifndef MICROPY_GC_SIZE_CLASSES
+#define MICROPY_GC_SIZE_CLASSES (0)
+#endif
+
+// Maximum number of free runs remembered per size class.
+#ifndef MICROPY_GC_SIZE_CLASS_DEPTH
+#define MICROPY_GC_SIZE_CLASS_DEPTH (8)
+#endif
+
+// Whether the GC records how long each collection holds up the VM, for
+// gc.pause_info().  Collections still run to completion in one pass.
+#ifndef MICROPY_GC_PAUSE_STATS
+#define MICROPY_GC_PAUSE_STATS (0)
+#endif
+
+// Microsecond time source used to measure collections.
+#ifndef MICROPY_GC_TICKS_US
+#define MICROPY_GC_TICKS_US() mp_hal_ticks_us()
+#endif
+
 // Hook to run code during time consuming garbage collector operations
 // *i* is the loop index variable (e.g. can be used to run every x loops)
 #ifndef MICROPY_GC_HOOK_LOOP
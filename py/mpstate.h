@@ -88,6 +88,16 @@ typedef struct _mp_sched_item_t {
     mp_obj_t arg;
 } mp_sched_item_t;
 
+#if MICROPY_OPT_ATTR_INLINE_CACHE
+// An inline cache entry for an attribute access site in the bytecode VM.
+// The pointers are only compared, so they need not be kept alive.
+typedef struct _mp_attr_cache_entry_t {
+    const byte *site;
+    const void *type;
+    size_t index;
+} mp_attr_cache_entry_t;
+#endif
+
 // This structure holds information about a single contiguous area of
 // memory reserved for the memory manager.
 typedef struct _mp_state_mem_area_t {
@@ -105,6 +115,14 @@ typedef struct _mp_state_mem_area_t {
 
     size_t gc_last_free_atb_index;
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
+
+    #if MICROPY_GC_SIZE_CLASSES
+    // Stacks of known free runs (start block and length) for each size class.
+    // Entries are hints: gc_alloc verifies them against the ATB before use.
+    size_t gc_free_run_block[MICROPY_GC_SIZE_CLASSES][MICROPY_GC_SIZE_CLASS_DEPTH];
+    size_t gc_free_run_len[MICROPY_GC_SIZE_CLASSES][MICROPY_GC_SIZE_CLASS_DEPTH];
+    uint8_t gc_free_run_count[MICROPY_GC_SIZE_CLASSES];
+    #endif
 } mp_state_mem_area_t;
 
 // This structure hold information about the memory allocation system.
@@ -142,6 +160,14 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    #if MICROPY_GC_PAUSE_STATS
+    mp_uint_t gc_pause_start;
+    // Length of the last and the longest collection, in microseconds.
+    mp_uint_t gc_pause_last_us;
+    mp_uint_t gc_pause_max_us;
+    size_t gc_pause_count;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_mutex_t gc_mutex;
@@ -266,6 +292,11 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    #if MICROPY_OPT_ATTR_INLINE_CACHE
+    // See ATTR_CACHE_ENTRY in vm.c.
+    mp_attr_cache_entry_t attr_inline_cache[MICROPY_OPT_ATTR_INLINE_CACHE_SIZE];
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
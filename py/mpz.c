@@ -427,12 +427,12 @@ static size_t mpn_mul_dig_add_dig(mpz_dig_t *idig, size_t ilen, mpz_dig_t dmul,
     return idig - oidig;
 }
 
-/* computes i = j * k
+/* computes i = j * k using the schoolbook method
    returns number of digits in i
    assumes enough memory in i; assumes i is zeroed; assumes normalised j, k
    can have j, k point to same memory
 */
-static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen) {
+static size_t mpn_mul_basecase(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
     mpz_dig_t *oidig = idig;
     size_t ilen = 0;
 
@@ -441,7 +441,7 @@ static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
         mpz_dbl_dig_t carry = 0;
 
         size_t jl = jlen;
-        for (mpz_dig_t *jd = jdig; jl > 0; --jl, ++jd, ++id) {
+        for (const mpz_dig_t *jd = jdig; jl > 0; --jl, ++jd, ++id) {
             carry += (mpz_dbl_dig_t)*id + (mpz_dbl_dig_t)*jd * (mpz_dbl_dig_t)*kdig; // will never overflow so long as DIG_SIZE <= 8*sizeof(mpz_dbl_dig_t)/2
             *id = carry & DIG_MASK;
             carry >>= DIG_SIZE;
@@ -461,6 +461,222 @@ static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+#if MICROPY_OPT_MPZ_KARATSUBA
+
+/* computes i = j + k over jlen digits
+   returns the carry out of the top digit
+   assumes enough memory in i; assumes jlen >= klen
+   can have i, j, k pointing to same memory
+*/
+static mpz_dig_t mpn_add_fixed(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
+    mpz_dbl_dig_t carry = 0;
+
+    jlen -= klen;
+
+    for (; klen > 0; --klen, ++idig, ++jdig, ++kdig) {
+        carry += (mpz_dbl_dig_t)*jdig + (mpz_dbl_dig_t)*kdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        carry += *jdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    return carry;
+}
+
+/* computes i = i - k over ilen digits
+   assumes ilen >= klen; assumes i >= k
+*/
+static void mpn_sub_fixed_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *kdig, size_t klen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+
+    ilen -= klen;
+
+    for (; klen > 0; --klen, ++idig, ++kdig) {
+        borrow += (mpz_dbl_dig_t)*idig - (mpz_dbl_dig_t)*kdig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; ilen > 0 && borrow != 0; --ilen, ++idig) {
+        borrow += *idig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+/* returns the number of scratch digits that mpn_mul_karatsuba_rec needs
+   when the longer operand has n digits
+*/
+static size_t mpn_mul_karatsuba_scratch(size_t n) {
+    size_t s = 0;
+    while (n >= MICROPY_MPZ_KARATSUBA_THRESHOLD) {
+        size_t m = (n + 1) / 2;
+        s += 4 * m + 4;
+        n = m + 1;
+    }
+    return s;
+}
+
+/* computes i = j * k, writing all jlen + klen digits of i
+   assumes jlen >= klen; j and k need not be normalised
+   i must not overlap j, k or the scratch memory
+*/
+static void mpn_mul_karatsuba_rec(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen, mpz_dig_t *scratch) {
+    if (klen < MICROPY_MPZ_KARATSUBA_THRESHOLD) {
+        memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+        mpn_mul_basecase(idig, jdig, jlen, kdig, klen);
+        return;
+    }
+
+    // split j at m digits: j = j1 * B^m + j0
+    size_t m = (jlen + 1) / 2;
+    size_t j1len = jlen - m;
+
+    if (klen <= m) {
+        // k is short, so compute j0 * k + j1 * k * B^m
+        mpn_mul_karatsuba_rec(idig, jdig, m, kdig, klen, scratch);
+        memset(idig + m + klen, 0, j1len * sizeof(mpz_dig_t));
+        mpz_dig_t *t = scratch;
+        if (j1len >= klen) {
+            mpn_mul_karatsuba_rec(t, jdig + m, j1len, kdig, klen, scratch + j1len + klen);
+        } else {
+            mpn_mul_karatsuba_rec(t, kdig, klen, jdig + m, j1len, scratch + j1len + klen);
+        }
+        mpn_add_fixed(idig + m, idig + m, jlen + klen - m, t, j1len + klen);
+        return;
+    }
+
+    // split k at m digits too; z0 = j0 * k0 and z2 = j1 * k1 go straight into i
+    size_t k1len = klen - m;
+    mpn_mul_karatsuba_rec(idig, jdig, m, kdig, m, scratch);
+    mpn_mul_karatsuba_rec(idig + 2 * m, jdig + m, j1len, kdig + m, k1len, scratch);
+
+    // z1 = (j0 + j1) * (k0 + k1) - z0 - z2
+    mpz_dig_t *js = scratch;
+    mpz_dig_t *ks = js + m + 1;
+    mpz_dig_t *z1 = ks + m + 1;
+    js[m] = mpn_add_fixed(js, jdig, m, jdig + m, j1len);
+    ks[m] = mpn_add_fixed(ks, kdig, m, kdig + m, k1len);
+    mpn_mul_karatsuba_rec(z1, js, m + 1, ks, m + 1, z1 + 2 * m + 2);
+    mpn_sub_fixed_inpl(z1, 2 * m + 2, idig, 2 * m);
+    mpn_sub_fixed_inpl(z1, 2 * m + 2, idig + 2 * m, j1len + k1len);
+
+    // i += z1 * B^m; z1 is less than B^(jlen + klen - m) so any digits above that are zero
+    size_t z1len = 2 * m + 2;
+    if (z1len > jlen + klen - m) {
+        z1len = jlen + klen - m;
+    }
+    mpn_add_fixed(idig + m, idig + m, jlen + klen - m, z1, z1len);
+}
+
+/* computes i = j * k using Karatsuba's method
+   returns number of digits in i
+   assumes enough memory in i; assumes normalised j, k
+   can have j, k point to same memory
+*/
+static size_t mpn_mul_karatsuba(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
+    if (jlen < klen) {
+        const mpz_dig_t *tdig = jdig;
+        jdig = kdig;
+        kdig = tdig;
+        size_t tlen = jlen;
+        jlen = klen;
+        klen = tlen;
+    }
+
+    size_t scratch_len = mpn_mul_karatsuba_scratch(jlen);
+    mpz_dig_t *scratch = m_new(mpz_dig_t, scratch_len);
+    mpn_mul_karatsuba_rec(idig, jdig, jlen, kdig, klen, scratch);
+    m_del(mpz_dig_t, scratch, scratch_len);
+
+    size_t ilen = jlen + klen;
+    while (ilen > 0 && idig[ilen - 1] == 0) {
+        --ilen;
+    }
+    return ilen;
+}
+
+#endif // MICROPY_OPT_MPZ_KARATSUBA
+
+/* computes i = j * k
+   returns number of digits in i
+   assumes enough memory in i; assumes i is zeroed; assumes normalised j, k
+   can have j, k point to same memory
+*/
+static size_t mpn_mul(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
+    #if MICROPY_OPT_MPZ_KARATSUBA
+    if (jlen >= MICROPY_MPZ_KARATSUBA_THRESHOLD && klen >= MICROPY_MPZ_KARATSUBA_THRESHOLD) {
+        return mpn_mul_karatsuba(idig, jdig, jlen, kdig, klen);
+    }
+    #endif
+    return mpn_mul_basecase(idig, jdig, jlen, kdig, klen);
+}
+
+#if MICROPY_OPT_MPZ_MONTGOMERY
+
+/* returns -m^-1 mod B, where m is the lowest digit of an odd modulus
+*/
+static mpz_dig_t mpn_mont_inverse(mpz_dig_t m) {
+    // m * m == 1 mod 8, and each Newton step doubles the number of correct bits
+    mpz_dbl_dig_t inv = m;
+    for (unsigned int bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = inv * (2 - m * inv);
+    }
+    return (mpz_dig_t)(-inv & DIG_MASK);
+}
+
+/* computes i = j * k / B^n mod m (Montgomery multiplication)
+   assumes j, k < m, all of n digits; assumes m is odd; minv is -m^-1 mod B
+   t must have n + 2 digits of scratch memory
+   can have i, j, k pointing to same memory
+*/
+static void mpn_mont_mul(mpz_dig_t *idig, const mpz_dig_t *jdig, const mpz_dig_t *kdig, const mpz_dig_t *mdig, size_t n, mpz_dig_t minv, mpz_dig_t *t) {
+    memset(t, 0, (n + 2) * sizeof(mpz_dig_t));
+
+    for (size_t i = 0; i < n; ++i) {
+        // t += j[i] * k
+        mpz_dbl_dig_t carry = 0;
+        for (size_t x = 0; x < n; ++x) {
+            carry += (mpz_dbl_dig_t)t[x] + (mpz_dbl_dig_t)jdig[i] * (mpz_dbl_dig_t)kdig[x]; // will never overflow so long as DIG_SIZE <= 8*sizeof(mpz_dbl_dig_t)/2
+            t[x] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[n];
+        t[n] = carry & DIG_MASK;
+        t[n + 1] = carry >> DIG_SIZE;
+
+        // t = (t + u * m) / B, choosing u so the lowest digit becomes zero
+        mpz_dig_t u = ((mpz_dbl_dig_t)t[0] * minv) & DIG_MASK;
+        carry = ((mpz_dbl_dig_t)t[0] + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)mdig[0]) >> DIG_SIZE;
+        for (size_t x = 1; x < n; ++x) {
+            carry += (mpz_dbl_dig_t)t[x] + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)mdig[x];
+            t[x - 1] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[n];
+        t[n - 1] = carry & DIG_MASK;
+        t[n] = t[n + 1] + (carry >> DIG_SIZE);
+    }
+
+    // t < 2 * m, so at most one subtraction brings it into range
+    if (t[n] != 0 || mpn_cmp(t, n, mdig, n) >= 0) {
+        mpz_dbl_dig_signed_t borrow = 0;
+        for (size_t x = 0; x < n; ++x) {
+            borrow += (mpz_dbl_dig_t)t[x] - (mpz_dbl_dig_t)mdig[x];
+            t[x] = borrow & DIG_MASK;
+            borrow >>= DIG_SIZE;
+        }
+    }
+    memcpy(idig, t, n * sizeof(mpz_dig_t));
+}
+
+#endif // MICROPY_OPT_MPZ_MONTGOMERY
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -1359,12 +1575,85 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
+#if MICROPY_OPT_MPZ_MONTGOMERY
+/* computes dest = (lhs ** rhs) % mod using Montgomery multiplication
+   assumes rhs > 0; assumes mod is odd and has at least 2 digits
+   the square-and-multiply loop then needs no divisions, only two to set up
+*/
+static void mpz_pow3_montgomery(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t n = mod->len;
+    mpz_dig_t minv = mpn_mont_inverse(mod->dig[0]);
+
+    mpz_t quo, one, x;
+    mpz_init_zero(&quo);
+    mpz_init_zero(&one);
+    mpz_init_zero(&x);
+
+    // one = B^n % mod, x = (lhs * B^n) % mod; these are 1 and lhs in Montgomery form
+    mpz_set_from_int(&x, 1);
+    mpz_shl_inpl(&x, &x, n * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &one, &x, mod);
+    mpz_shl_inpl(&x, lhs, n * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &x, &x, mod);
+
+    // work with fixed-size buffers of n digits: acc, x, and n + 2 digits of scratch
+    mpz_dig_t *buf = m_new0(mpz_dig_t, 3 * n + 2);
+    mpz_dig_t *acc = buf;
+    mpz_dig_t *xd = buf + n;
+    mpz_dig_t *t = buf + 2 * n;
+    memcpy(acc, one.dig, one.len * sizeof(mpz_dig_t));
+    memcpy(xd, x.dig, x.len * sizeof(mpz_dig_t));
+
+    for (size_t i = 0; i < rhs->len; ++i) {
+        mpz_dig_t d = rhs->dig[i];
+        for (size_t b = 0; b < DIG_SIZE; ++b, d >>= 1) {
+            if ((d & 1) != 0) {
+                mpn_mont_mul(acc, acc, xd, mod->dig, n, minv, t);
+            }
+            if (d == 1 && i + 1 == rhs->len) {
+                break;
+            }
+            mpn_mont_mul(xd, xd, xd, mod->dig, n, minv, t);
+        }
+        // CIRCUITPY-CHANGE: prevent usb and other background task starvation
+        #ifdef RUN_BACKGROUND_TASKS
+        RUN_BACKGROUND_TASKS;
+        #endif
+    }
+
+    // convert back out of Montgomery form by multiplying with 1
+    memset(xd, 0, n * sizeof(mpz_dig_t));
+    xd[0] = 1;
+    mpn_mont_mul(acc, acc, xd, mod->dig, n, minv, t);
+
+    mpz_need_dig(dest, n);
+    memcpy(dest->dig, acc, n * sizeof(mpz_dig_t));
+    dest->neg = 0;
+    dest->len = n;
+    while (dest->len > 0 && dest->dig[dest->len - 1] == 0) {
+        --dest->len;
+    }
+
+    m_del(mpz_dig_t, buf, 3 * n + 2);
+    mpz_deinit(&x);
+    mpz_deinit(&one);
+    mpz_deinit(&quo);
+}
+#endif
+
 void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
     if (lhs->len == 0 || rhs->neg != 0 || (mod->len == 1 && mod->dig[0] == 1)) {
         mpz_set_from_int(dest, 0);
         return;
     }
 
+    #if MICROPY_OPT_MPZ_MONTGOMERY
+    if (rhs->len != 0 && mod->neg == 0 && mod->len >= 2 && (mod->dig[0] & 1) != 0) {
+        mpz_pow3_montgomery(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_set_from_int(dest, 1);
 
     if (rhs->len == 0) {
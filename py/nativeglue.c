@@ -34,6 +34,7 @@
 #include "py/smallint.h"
 #include "py/nativeglue.h"
 // CIRCUITPY-CHANGE
+#include "py/objfun.h"
 #include "py/objtype.h"
 #include "py/gc.h"
 
@@ -232,6 +233,34 @@ static bool mp_native_yield_from(mp_obj_t gen, mp_obj_t send_value, mp_obj_t *re
     return false;
 }
 
+// raises the same error as the VM for a local that is loaded or deleted while unbound
+static void mp_native_unbound_local(void) {
+    // The emitters index mp_fun_table with these, and they aren't in order with the others.
+    MP_STATIC_ASSERT(offsetof(mp_fun_table_t, unbound_local) == MP_F_NATIVE_UNBOUND_LOCAL * sizeof(void *));
+    MP_STATIC_ASSERT(offsetof(mp_fun_table_t, add_traceback) == MP_F_NATIVE_ADD_TRACEBACK * sizeof(void *));
+    mp_raise_msg(&mp_type_NameError, MP_ERROR_TEXT("local variable referenced before assignment"));
+}
+
+// adds the traceback entry that the VM would add for an exception passing through
+// a function compiled with emit=native-all; a line of 0 means the exception is
+// being re-raised at the end of a finally block, which the VM doesn't record again
+static void mp_native_add_traceback(mp_obj_t exc, mp_obj_t fun, size_t line, qstr block) {
+    if (line == 0
+        #if MICROPY_CONST_GENERATOREXIT_OBJ
+        || exc == MP_OBJ_FROM_PTR(&mp_const_GeneratorExit_obj)
+        #endif
+        ) {
+        return;
+    }
+    const mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(fun);
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    qstr source_file = self->context->constants.qstr_table[0];
+    #else
+    qstr source_file = self->context->constants.source_file;
+    #endif
+    mp_obj_exception_add_traceback(exc, source_file, line, block);
+}
+
 #if !MICROPY_PY_BUILTINS_FLOAT
 
 static mp_obj_t mp_obj_new_float_from_f(float f) {
@@ -357,6 +386,9 @@ const mp_fun_table_t mp_fun_table = {
     &mp_stream_readinto_obj,
     &mp_stream_unbuffered_readline_obj,
     &mp_stream_write_obj,
+    // CIRCUITPY-CHANGE: entries for emit=native-all
+    mp_native_unbound_local,
+    mp_native_add_traceback,
 };
 
 #elif MICROPY_EMIT_NATIVE && MICROPY_DYNAMIC_COMPILER
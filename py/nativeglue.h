@@ -82,6 +82,10 @@ typedef enum {
     MP_F_SMALL_INT_MODULO,
     MP_F_NATIVE_YIELD_FROM,
     MP_F_SETJMP,
+    // These come after the entries for the dynamic runtime in mp_fun_table,
+    // so that adding them didn't move the entries natmods already use.
+    MP_F_NATIVE_UNBOUND_LOCAL = 88,
+    MP_F_NATIVE_ADD_TRACEBACK,
     MP_F_NUMBER_OF,
 } mp_fun_kind_t;
 
@@ -182,6 +186,9 @@ typedef struct _mp_fun_table_t {
     const mp_obj_fun_builtin_var_t *stream_readinto_obj;
     const mp_obj_fun_builtin_var_t *stream_unbuffered_readline_obj;
     const mp_obj_fun_builtin_var_t *stream_write_obj;
+    // CIRCUITPY-CHANGE: entries for emit=native-all, starting at index 88
+    void (*unbound_local)(void);
+    void (*add_traceback)(mp_obj_t exc, mp_obj_t fun, size_t line, qstr block);
 } mp_fun_table_t;
 
 #if (MICROPY_EMIT_NATIVE && !MICROPY_DYNAMIC_COMPILER) || MICROPY_ENABLE_DYNRUNTIME
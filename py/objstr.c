@@ -315,32 +315,92 @@ wrong_args:
     mp_raise_TypeError(MP_ERROR_TEXT("wrong number of arguments"));
 }
 
-// like strstr but with specified length and allows \0 bytes
-// TODO replace with something more efficient/standard
-const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
-    if (hlen >= nlen) {
-        size_t str_index, str_index_end;
-        if (direction > 0) {
-            str_index = 0;
-            str_index_end = hlen - nlen;
-        } else {
-            str_index = hlen - nlen;
-            str_index_end = 0;
+#if MICROPY_OPT_FAST_STR_SEARCH
+// Boyer-Moore-Horspool search for needles of at least 2 bytes.  The skip table
+// uses one byte per entry to keep stack usage low; capping a shift at 255 is
+// always safe because it can only make the search advance less far.
+static const byte *find_subbytes_horspool(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
+    byte skip[256];
+    byte default_skip = nlen < 255 ? nlen : 255;
+    memset(skip, default_skip, sizeof(skip));
+    const byte last = needle[nlen - 1];
+    if (direction > 0) {
+        // shift by the distance from the last occurrence of the byte under the
+        // end of the window to the end of the needle
+        for (size_t i = 0; i < nlen - 1; ++i) {
+            size_t d = nlen - 1 - i;
+            skip[needle[i]] = d < 255 ? d : 255;
+        }
+        for (const byte *p = haystack, *p_end = haystack + hlen - nlen; p <= p_end;) {
+            byte c = p[nlen - 1];
+            if (c == last && memcmp(p, needle, nlen - 1) == 0) {
+                return p;
+            }
+            p += skip[c];
         }
-        for (;;) {
-            if (memcmp(&haystack[str_index], needle, nlen) == 0) {
-                // found
-                return haystack + str_index;
+    } else {
+        // mirror image: shift by the distance from the start of the needle to
+        // the first occurrence of the byte under the start of the window
+        for (size_t i = nlen - 1; i > 0; --i) {
+            skip[needle[i]] = i < 255 ? i : 255;
+        }
+        for (size_t i = hlen - nlen;;) {
+            const byte *p = haystack + i;
+            if (p[0] == needle[0] && memcmp(p + 1, needle + 1, nlen - 1) == 0) {
+                return p;
             }
-            if (str_index == str_index_end) {
-                // not found
+            if (i < skip[p[0]]) {
                 break;
             }
-            str_index += direction;
+            i -= skip[p[0]];
         }
     }
     return NULL;
 }
+#endif
+
+// like strstr but with specified length and allows \0 bytes
+const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
+    if (hlen < nlen) {
+        return NULL;
+    }
+    #if MICROPY_OPT_FAST_STR_SEARCH
+    if (nlen == 1) {
+        if (direction > 0) {
+            return memchr(haystack, needle[0], hlen);
+        }
+        for (const byte *p = haystack + hlen; p > haystack;) {
+            if (*--p == needle[0]) {
+                return p;
+            }
+        }
+        return NULL;
+    }
+    // building the skip table only pays off if there are enough positions to try
+    if (nlen > 1 && hlen - nlen >= 32) {
+        return find_subbytes_horspool(haystack, hlen, needle, nlen, direction);
+    }
+    #endif
+    size_t str_index, str_index_end;
+    if (direction > 0) {
+        str_index = 0;
+        str_index_end = hlen - nlen;
+    } else {
+        str_index = hlen - nlen;
+        str_index_end = 0;
+    }
+    for (;;) {
+        if (memcmp(&haystack[str_index], needle, nlen) == 0) {
+            // found
+            return haystack + str_index;
+        }
+        if (str_index == str_index_end) {
+            // not found
+            return NULL;
+        }
+        str_index += direction;
+    }
+}
 
 // Note: this function is used to check if an object is a str or bytes, which
 // works because both those types use it as their binary_op method.  Revisit
@@ -620,14 +680,8 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
 
         for (;;) {
             const byte *start = s;
-            for (;;) {
-                if (splits == 0 || s + sep_len > top) {
-                    s = top;
-                    break;
-                } else if (memcmp(s, sep_str, sep_len) == 0) {
-                    break;
-                }
-                s++;
+            if (splits == 0 || (s = find_subbytes(s, top - s, (const byte *)sep_str, sep_len, 1)) == NULL) {
+                s = top;
             }
             mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, start, s - start));
             if (s >= top) {
@@ -726,16 +780,8 @@ static mp_obj_t str_rsplit(size_t n_args, const mp_obj_t *args) {
         const byte *beg = s;
         const byte *last = s + len;
         for (;;) {
-            s = last - sep_len;
-            for (;;) {
-                if (splits == 0 || s < beg) {
-                    break;
-                } else if (memcmp(s, sep_str, sep_len) == 0) {
-                    break;
-                }
-                s--;
-            }
-            if (s < beg || splits == 0) {
+            s = splits == 0 ? NULL : find_subbytes(beg, last - beg, (const byte *)sep_str, sep_len, -1);
+            if (s == NULL) {
                 res->items[idx] = mp_obj_new_str_of_type(self_type, beg, last - beg);
                 break;
             }
@@ -1813,17 +1859,16 @@ static mp_obj_t str_count(size_t n_args, const mp_obj_t *args) {
         return MP_OBJ_NEW_SMALL_INT(utf8_charlen(start, end - start) + 1);
     }
 
-    bool is_str = self_type == &mp_type_str;
-
-    // count the occurrences
+    // count the non-overlapping occurrences; for str a match of valid UTF-8
+    // always starts on a character boundary so a byte search is sufficient
     mp_int_t num_occurrences = 0;
-    for (const byte *haystack_ptr = start; haystack_ptr + needle_len <= end;) {
-        if (memcmp(haystack_ptr, needle, needle_len) == 0) {
-            num_occurrences++;
-            haystack_ptr += needle_len;
-        } else {
-            haystack_ptr = is_str ? utf8_next_char(haystack_ptr) : haystack_ptr + 1;
+    for (const byte *haystack_ptr = start; haystack_ptr <= end;) {
+        haystack_ptr = find_subbytes(haystack_ptr, end - haystack_ptr, needle, needle_len, 1);
+        if (haystack_ptr == NULL) {
+            break;
         }
+        num_occurrences++;
+        haystack_ptr += needle_len;
     }
 
     return MP_OBJ_NEW_SMALL_INT(num_occurrences);
@@ -906,6 +906,53 @@ static const byte *mp_prof_opcode_decode(const byte *ip, const mp_uint_t *const_
             instruction->qstr_opname = MP_QSTR_IMPORT_STAR;
             break;
 
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        case MP_BC_LOAD_ATTR_LOCAL_0:
+            DECODE_QSTR;
+            instruction->qstr_opname = MP_QSTR_LOAD_ATTR_LOCAL_0;
+            instruction->arg = qst;
+            instruction->argobj = MP_OBJ_NEW_QSTR(qst);
+            break;
+
+        case MP_BC_LOAD_METHOD_LOCAL_0:
+            DECODE_QSTR;
+            instruction->qstr_opname = MP_QSTR_LOAD_METHOD_LOCAL_0;
+            instruction->arg = qst;
+            instruction->argobj = MP_OBJ_NEW_QSTR(qst);
+            break;
+
+        case MP_BC_STORE_ATTR_LOCAL_0:
+            DECODE_QSTR;
+            instruction->qstr_opname = MP_QSTR_STORE_ATTR_LOCAL_0;
+            instruction->arg = qst;
+            instruction->argobj = MP_OBJ_NEW_QSTR(qst);
+            break;
+
+        case MP_BC_BINARY_OP_POP_JUMP_IF:
+            DECODE_SLABEL;
+            instruction->qstr_opname = *ip >> 7 ? MP_QSTR_BINARY_OP_POP_JUMP_IF_TRUE : MP_QSTR_BINARY_OP_POP_JUMP_IF_FALSE;
+            instruction->arg = unum;
+            instruction->argobjex_cache = MP_OBJ_NEW_SMALL_INT(*ip & 0x7f);
+            ip += 1;
+            break;
+        #endif
+
+        #if MICROPY_OPT_BC_QUICKEN
+        case MP_BC_BINARY_OP_SMALL_INT_LESS:
+        case MP_BC_BINARY_OP_SMALL_INT_MORE:
+        case MP_BC_BINARY_OP_SMALL_INT_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_LESS_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_MORE_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_NOT_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD:
+        case MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT:
+        case MP_BC_BINARY_OP_SMALL_INT_ADD:
+        case MP_BC_BINARY_OP_SMALL_INT_SUBTRACT:
+            instruction->qstr_opname = MP_QSTR_BINARY_OP_SMALL_INT;
+            instruction->arg = (mp_uint_t)ip[-1] - MP_BC_BINARY_OP_SMALL_INT_LESS;
+            break;
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 instruction->qstr_opname = MP_QSTR_LOAD_CONST_SMALL_INT;
@@ -60,13 +60,30 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
+#if MICROPY_QSTR_HASH_INDEX
+// The 32-bit hash that qstr_compute_hash truncates; it keys the pool indexes,
+// which need more bits than are stored per qstr.
+// this must match the equivalent function in makeqstrdata.py
+uint32_t qstr_compute_full_hash(const byte *data, size_t len) {
+    uint32_t hash = 5381;
+    for (const byte *top = data + len; data < top; data++) {
+        hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
+    }
+    return hash;
+}
+#endif
+
 // this must match the equivalent function in makeqstrdata.py
 size_t qstr_compute_hash(const byte *data, size_t len) {
+    #if MICROPY_QSTR_HASH_INDEX
+    size_t hash = qstr_compute_full_hash(data, len);
+    #else
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    #endif
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -111,6 +128,26 @@ const qstr_len_t mp_qstr_const_lengths_static[] = {
     #endif
 };
 
+#if MICROPY_QSTR_HASH_INDEX
+const qstr_index_t mp_qstr_const_index_static[] = {
+    #ifndef NO_QSTR
+#define QDEF0(id, hash, len, str)
+#define QDEF1(id, hash, len, str)
+// CIRCUITPY-CHANGE: translations
+#define TRANSLATION(id, length, compressed ...)
+#define QINDEX0(i) i,
+#define QINDEX1(i)
+    #include "genhdr/qstrdefs.generated.h"
+#undef QDEF0
+#undef QDEF1
+// CIRCUITPY-CHANGE: translations
+#undef TRANSLATION
+#undef QINDEX0
+#undef QINDEX1
+    #endif
+};
+#endif
+
 const qstr_pool_t mp_qstr_const_pool_static = {
     NULL,               // no previous pool
     0,                  // no previous pool
@@ -121,6 +158,10 @@ const qstr_pool_t mp_qstr_const_pool_static = {
     (qstr_hash_t *)mp_qstr_const_hashes_static,
     #endif
     (qstr_len_t *)mp_qstr_const_lengths_static,
+    #if MICROPY_QSTR_HASH_INDEX
+    (qstr_index_t *)mp_qstr_const_index_static,
+    MP_ARRAY_SIZE(mp_qstr_const_index_static) - 1,
+    #endif
     {
         #ifndef NO_QSTR
 #define QDEF0(id, hash, len, str) str,
@@ -168,6 +209,26 @@ const qstr_len_t mp_qstr_const_lengths[] = {
     #endif
 };
 
+#if MICROPY_QSTR_HASH_INDEX
+const qstr_index_t mp_qstr_const_index[] = {
+    #ifndef NO_QSTR
+#define QDEF0(id, hash, len, str)
+#define QDEF1(id, hash, len, str)
+// CIRCUITPY-CHANGE: translations
+#define TRANSLATION(id, length, compressed ...)
+#define QINDEX0(i)
+#define QINDEX1(i) i,
+    #include "genhdr/qstrdefs.generated.h"
+#undef QDEF0
+#undef QDEF1
+// CIRCUITPY-CHANGE: translations
+#undef TRANSLATION
+#undef QINDEX0
+#undef QINDEX1
+    #endif
+};
+#endif
+
 const qstr_pool_t mp_qstr_const_pool = {
     &mp_qstr_const_pool_static,
     MP_QSTRnumber_of_static,
@@ -178,6 +239,10 @@ const qstr_pool_t mp_qstr_const_pool = {
     (qstr_hash_t *)mp_qstr_const_hashes,
     #endif
     (qstr_len_t *)mp_qstr_const_lengths,
+    #if MICROPY_QSTR_HASH_INDEX
+    (qstr_index_t *)mp_qstr_const_index,
+    MP_ARRAY_SIZE(mp_qstr_const_index) - 1,
+    #endif
     {
         #ifndef NO_QSTR
 #define QDEF0(id, hash, len, str)
@@ -230,6 +295,9 @@ static const qstr_pool_t *find_qstr(qstr *q) {
 
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
+    #if MICROPY_QSTR_HASH_INDEX
+    uint32_t full_hash = qstr_compute_full_hash((const byte *)q_ptr, len);
+    #endif
     #if MICROPY_QSTR_BYTES_IN_HASH
     mp_uint_t hash = qstr_compute_hash((const byte *)q_ptr, len);
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
@@ -244,12 +312,26 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
         // Put a lower bound on the allocation size in case the extra qstr pool has few entries
         new_alloc = MAX(MICROPY_ALLOC_QSTR_ENTRIES_INIT, new_alloc);
         #endif
+        #if MICROPY_QSTR_HASH_INDEX
+        // keep the index at most half full; entries must fit a qstr_index_t
+        size_t index_len = 0;
+        if (new_alloc < (qstr_index_t)-1) {
+            index_len = 2;
+            while (index_len < 2 * new_alloc) {
+                index_len *= 2;
+            }
+        }
+        #endif
         mp_uint_t pool_size = sizeof(qstr_pool_t)
             + (sizeof(const char *)
                 #if MICROPY_QSTR_BYTES_IN_HASH
                 + sizeof(qstr_hash_t)
                 #endif
-                + sizeof(qstr_len_t)) * new_alloc;
+                + sizeof(qstr_len_t)) * new_alloc
+            #if MICROPY_QSTR_HASH_INDEX
+            + sizeof(qstr_index_t) * index_len
+            #endif
+        ;
         qstr_pool_t *pool = (qstr_pool_t *)m_malloc_maybe(pool_size);
         if (pool == NULL) {
             // Keep qstr_last_chunk consistent with qstr_pool_t: qstr_last_chunk is not scanned
@@ -261,12 +343,22 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
             QSTR_EXIT();
             m_malloc_fail(new_alloc);
         }
+        #if MICROPY_QSTR_HASH_INDEX
+        // the index goes first so that it is aligned
+        pool->index = index_len ? (qstr_index_t *)(pool->qstrs + new_alloc) : NULL;
+        pool->index_mask = index_len - 1;
+        memset(pool->qstrs + new_alloc, 0, sizeof(qstr_index_t) * index_len);
+        #define QSTR_POOL_DATA_START ((qstr_index_t *)(pool->qstrs + new_alloc) + index_len)
+        #else
+        #define QSTR_POOL_DATA_START (pool->qstrs + new_alloc)
+        #endif
         #if MICROPY_QSTR_BYTES_IN_HASH
-        pool->hashes = (qstr_hash_t *)(pool->qstrs + new_alloc);
+        pool->hashes = (qstr_hash_t *)QSTR_POOL_DATA_START;
         pool->lengths = (qstr_len_t *)(pool->hashes + new_alloc);
         #else
-        pool->lengths = (qstr_len_t *)(pool->qstrs + new_alloc);
+        pool->lengths = (qstr_len_t *)QSTR_POOL_DATA_START;
         #endif
+        #undef QSTR_POOL_DATA_START
         pool->prev = MP_STATE_VM(last_pool);
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
         pool->alloc = new_alloc;
@@ -284,6 +376,17 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
 
+    #if MICROPY_QSTR_HASH_INDEX
+    qstr_pool_t *pool = MP_STATE_VM(last_pool);
+    if (pool->index != NULL) {
+        size_t slot = full_hash & pool->index_mask;
+        while (pool->index[slot] != 0) {
+            slot = (slot + 1) & pool->index_mask;
+        }
+        pool->index[slot] = at + 1;
+    }
+    #endif
+
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
@@ -294,13 +397,44 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
         return MP_QSTR_;
     }
 
+    #if MICROPY_QSTR_HASH_INDEX
+    // work out hash of str
+    uint32_t str_full_hash = qstr_compute_full_hash((const byte *)str, str_len);
     #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = str_full_hash & Q_HASH_MASK;
+    if (str_hash == 0) {
+        str_hash++;
+    }
+    #endif
+    #elif MICROPY_QSTR_BYTES_IN_HASH
     // work out hash of str
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
 
     // search pools for the data
     for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+        #if MICROPY_QSTR_HASH_INDEX
+        if (pool->index != NULL) {
+            // probe the index until an empty slot ends the chain
+            for (size_t slot = str_full_hash & pool->index_mask;; slot = (slot + 1) & pool->index_mask) {
+                size_t at = pool->index[slot];
+                if (at == 0) {
+                    break;
+                }
+                at -= 1;
+                if (
+                    #if MICROPY_QSTR_BYTES_IN_HASH
+                    pool->hashes[at] == str_hash &&
+                    #endif
+                    pool->lengths[at] == str_len
+                    && memcmp(pool->qstrs[at], str, str_len) == 0) {
+                    return pool->total_prev_len + at;
+                }
+            }
+            continue;
+        }
+        #endif
+
         size_t low = 0;
         size_t high = pool->len - 1;
 
@@ -82,6 +82,11 @@ typedef uint16_t qstr_len_t;
 #error unimplemented qstr length decoding
 #endif
 
+#if MICROPY_QSTR_HASH_INDEX
+// Entry in a pool's hash index: 1 + position in the pool, or 0 if empty.
+typedef uint16_t qstr_index_t;
+#endif
+
 typedef struct _qstr_pool_t {
     const struct _qstr_pool_t *prev;
     size_t total_prev_len : (8 * sizeof(size_t) - 1);
@@ -92,6 +97,12 @@ typedef struct _qstr_pool_t {
     qstr_hash_t *hashes;
     #endif
     qstr_len_t *lengths;
+    #if MICROPY_QSTR_HASH_INDEX
+    // Open-addressed (linear probing) table of index_mask + 1 entries, keyed
+    // on qstr_compute_full_hash.  NULL if the pool has no index.
+    qstr_index_t *index;
+    size_t index_mask;
+    #endif
     const char *qstrs[];
 } qstr_pool_t;
 
@@ -102,6 +113,9 @@ void qstr_reset(void);
 void qstr_init(void);
 
 size_t qstr_compute_hash(const byte *data, size_t len);
+#if MICROPY_QSTR_HASH_INDEX
+uint32_t qstr_compute_full_hash(const byte *data, size_t len);
+#endif
 
 qstr qstr_find_strn(const char *str, size_t str_len); // returns MP_QSTRnull if not found
 
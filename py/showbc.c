@@ -526,6 +526,45 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        case MP_BC_LOAD_ATTR_LOCAL_0:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_ATTR_LOCAL_0 %s", qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_METHOD_LOCAL_0:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_METHOD_LOCAL_0 %s", qstr_str(qst));
+            break;
+
+        case MP_BC_STORE_ATTR_LOCAL_0:
+            DECODE_QSTR;
+            mp_printf(print, "STORE_ATTR_LOCAL_0 %s", qstr_str(qst));
+            break;
+
+        case MP_BC_BINARY_OP_POP_JUMP_IF:
+            DECODE_SLABEL;
+            mp_printf(print, "BINARY_OP_POP_JUMP_IF_%s " UINT_FMT " " UINT_FMT " %s", *ip >> 7 ? "TRUE" : "FALSE",
+                (mp_uint_t)(ip + unum - ip_start), (mp_uint_t)(*ip & 0x7f), qstr_str(mp_binary_op_method_name[*ip & 0x7f]));
+            ip += 1;
+            break;
+        #endif
+
+        #if MICROPY_OPT_BC_QUICKEN
+        case MP_BC_BINARY_OP_SMALL_INT_LESS:
+        case MP_BC_BINARY_OP_SMALL_INT_MORE:
+        case MP_BC_BINARY_OP_SMALL_INT_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_LESS_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_MORE_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_NOT_EQUAL:
+        case MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD:
+        case MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT:
+        case MP_BC_BINARY_OP_SMALL_INT_ADD:
+        case MP_BC_BINARY_OP_SMALL_INT_SUBTRACT:
+            mp_printf(print, "BINARY_OP_SMALL_INT " UINT_FMT, (mp_uint_t)ip[-1] - MP_BC_BINARY_OP_SMALL_INT_LESS);
+            break;
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
@@ -35,6 +35,8 @@
 #include "py/runtime.h"
 #include "py/bc0.h"
 #include "py/profile.h"
+#include "py/gc.h"
+#include "py/smallint.h"
 
 // *FORMAT-OFF*
 
@@ -205,6 +207,206 @@ static mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+#if MICROPY_OPT_ATTR_INLINE_CACHE
+
+// Inline caches for LOAD_ATTR, LOAD_METHOD and STORE_ATTR.  Each call site,
+// identified by the address of its qstr operand, gets an entry remembering the
+// type it last saw and the slot of the map the attribute was found in.  Before
+// a hit is used the slot is checked to still hold the attribute, so maps can be
+// mutated or reallocated without invalidating anything, and a stale entry only
+// costs a normal lookup.  The type pointer is compared but never dereferenced.
+#define ATTR_CACHE_ENTRY(site) (&MP_STATE_VM(attr_inline_cache)[(uintptr_t)(site) & (MICROPY_OPT_ATTR_INLINE_CACHE_SIZE - 1)])
+
+static inline mp_map_elem_t *attr_cache_get(const mp_attr_cache_entry_t *entry, const byte *site, const void *type, const mp_map_t *map, qstr attr) {
+    if (entry->site == site && entry->type == type && entry->index < map->alloc) {
+        mp_map_elem_t *elem = &map->table[entry->index];
+        if (elem->key == MP_OBJ_NEW_QSTR(attr)) {
+            return elem;
+        }
+    }
+    return NULL;
+}
+
+static inline void attr_cache_set(mp_attr_cache_entry_t *entry, const byte *site, const void *type, const mp_map_t *map, const mp_map_elem_t *elem) {
+    entry->site = site;
+    entry->type = type;
+    entry->index = elem - map->table;
+}
+
+// Class attributes that mp_convert_member_lookup returns unchanged.
+static inline bool attr_cache_is_plain_class_attr(mp_obj_t value) {
+    return !mp_obj_is_type(value, &mp_type_staticmethod) && !mp_obj_is_type(value, &mp_type_classmethod);
+}
+
+// Class members that mp_convert_member_lookup binds to an instance of a Python class.
+static inline bool attr_cache_is_method(mp_obj_t value) {
+    if (!mp_obj_is_obj(value)) {
+        return false;
+    }
+    const mp_obj_type_t *type = ((mp_obj_base_t *)MP_OBJ_TO_PTR(value))->type;
+    return (type->flags & (MP_TYPE_FLAG_BINDS_SELF | MP_TYPE_FLAG_BUILTIN_FUN)) == MP_TYPE_FLAG_BINDS_SELF;
+}
+
+static mp_map_t *attr_cache_class_map(const mp_obj_type_t *type) {
+    if (!mp_obj_is_instance_type(type) || !MP_OBJ_TYPE_HAS_SLOT(type, locals_dict)) {
+        return NULL;
+    }
+    return &MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map;
+}
+
+// Handles instance members and attributes found directly in a Python class.
+static mp_obj_t vm_load_attr_cached(const byte *site, mp_obj_t base, qstr attr) {
+    mp_attr_cache_entry_t *entry = ATTR_CACHE_ENTRY(site);
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    mp_map_elem_t *elem;
+    if (mp_obj_is_instance_type(type)) {
+        // Instance members are always returned as-is (see mp_obj_instance_load_attr).
+        mp_map_t *members = &((mp_obj_instance_t *)MP_OBJ_TO_PTR(base))->members;
+        elem = attr_cache_get(entry, site, type, members, attr);
+        if (elem == NULL) {
+            elem = mp_map_lookup(members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+            if (elem == NULL) {
+                return mp_load_attr(base, attr);
+            }
+            attr_cache_set(entry, site, type, members, elem);
+        }
+        return elem->value;
+    }
+
+    mp_map_t *locals_map;
+    if (type == &mp_type_type && (locals_map = attr_cache_class_map(MP_OBJ_TO_PTR(base))) != NULL) {
+        // Attribute of a Python class, found in its own locals dict.
+        elem = attr_cache_get(entry, site, MP_OBJ_TO_PTR(base), locals_map, attr);
+        if (elem != NULL && attr_cache_is_plain_class_attr(elem->value)) {
+            return elem->value;
+        }
+        mp_obj_t obj = mp_load_attr(base, attr);
+        #if MICROPY_CPYTHON_COMPAT
+        // type_attr answers these before looking in the locals dict.
+        if (attr == MP_QSTR___name__ || attr == MP_QSTR___dict__ || attr == MP_QSTR___bases__) {
+            return obj;
+        }
+        #endif
+        elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+        if (elem != NULL && elem->value == obj && attr_cache_is_plain_class_attr(obj)) {
+            attr_cache_set(entry, site, MP_OBJ_TO_PTR(base), locals_map, elem);
+        }
+        return obj;
+    }
+
+    return mp_load_attr(base, attr);
+}
+
+// Handles methods found directly in the class of an instance of a Python class.
+static void vm_load_method_cached(const byte *site, mp_obj_t base, qstr attr, mp_obj_t *dest) {
+    mp_attr_cache_entry_t *entry = ATTR_CACHE_ENTRY(site);
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    mp_map_t *locals_map = attr_cache_class_map(type);
+    if (locals_map == NULL || (type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
+        mp_load_method(base, attr, dest);
+        return;
+    }
+
+    // A hit must still not be shadowed by an instance member.
+    mp_map_t *members = &((mp_obj_instance_t *)MP_OBJ_TO_PTR(base))->members;
+    mp_map_elem_t *elem = attr_cache_get(entry, site, type, locals_map, attr);
+    if (elem != NULL && attr_cache_is_method(elem->value)
+        && (members->used == 0 || mp_map_lookup(members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP) == NULL)) {
+        dest[0] = elem->value;
+        dest[1] = base;
+        return;
+    }
+
+    mp_load_method(base, attr, dest);
+    // __class__ and __next__ are answered before the class is searched.
+    if (dest[1] == base && attr != MP_QSTR___next__
+        #if MICROPY_CPYTHON_COMPAT
+        && attr != MP_QSTR___class__
+        #endif
+        ) {
+        elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+        if (elem != NULL && elem->value == dest[0] && attr_cache_is_method(dest[0])) {
+            attr_cache_set(entry, site, type, locals_map, elem);
+        }
+    }
+}
+
+// Handles stores to members of instances of Python classes.  A NULL value is
+// a delete (see mp_emit_bc_attr), which is left to mp_store_attr.
+static void vm_store_attr_cached(const byte *site, mp_obj_t base, qstr attr, mp_obj_t value) {
+    mp_attr_cache_entry_t *entry = ATTR_CACHE_ENTRY(site);
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    if (value == MP_OBJ_NULL || !mp_obj_is_instance_type(type) || (type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
+        mp_store_attr(base, attr, value);
+        return;
+    }
+
+    // Without special accessors the store goes straight to the members map
+    // (see mp_obj_instance_store_attr).
+    mp_map_t *members = &((mp_obj_instance_t *)MP_OBJ_TO_PTR(base))->members;
+    mp_map_elem_t *elem = attr_cache_get(entry, site, type, members, attr);
+    if (elem == NULL) {
+        elem = mp_map_lookup(members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+        attr_cache_set(entry, site, type, members, elem);
+    }
+    elem->value = value;
+}
+
+#endif // MICROPY_OPT_ATTR_INLINE_CACHE
+
+#if MICROPY_OPT_BC_SUPERINSTRUCTIONS || MICROPY_OPT_BC_QUICKEN
+// Evaluates a comparison op, LESS to NOT_EQUAL, on two small ints.
+static inline bool vm_small_int_compare(mp_uint_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+    mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+    switch (op) {
+        case MP_BINARY_OP_LESS:
+            return lhs_val < rhs_val;
+        case MP_BINARY_OP_MORE:
+            return lhs_val > rhs_val;
+        case MP_BINARY_OP_EQUAL:
+            return lhs_val == rhs_val;
+        case MP_BINARY_OP_LESS_EQUAL:
+            return lhs_val <= rhs_val;
+        case MP_BINARY_OP_MORE_EQUAL:
+            return lhs_val >= rhs_val;
+        default:
+            return lhs_val != rhs_val;
+    }
+}
+#endif
+
+#if MICROPY_OPT_BC_QUICKEN
+// The binary op that each of the MP_BC_BINARY_OP_SMALL_INT_xxx opcodes replaced.
+static const byte vm_quickened_binary_op[] = {
+    MP_BINARY_OP_LESS,
+    MP_BINARY_OP_MORE,
+    MP_BINARY_OP_EQUAL,
+    MP_BINARY_OP_LESS_EQUAL,
+    MP_BINARY_OP_MORE_EQUAL,
+    MP_BINARY_OP_NOT_EQUAL,
+    MP_BINARY_OP_INPLACE_ADD,
+    MP_BINARY_OP_INPLACE_SUBTRACT,
+    MP_BINARY_OP_ADD,
+    MP_BINARY_OP_SUBTRACT,
+};
+
+// Called when the BINARY_OP_MULTI opcode at ip has small int arguments.  Only
+// bytecode on the heap is rewritten: anything else may be frozen into flash.
+static void vm_quicken_binary_op(const byte *ip, mp_uint_t op) {
+    #if MICROPY_ENABLE_GC
+    for (size_t i = 0; i < MP_ARRAY_SIZE(vm_quickened_binary_op); ++i) {
+        if (vm_quickened_binary_op[i] == op) {
+            if (gc_ptr_on_heap((void *)ip)) {
+                *(byte *)ip = MP_BC_BINARY_OP_SMALL_INT_LESS + i;
+            }
+            return;
+        }
+    }
+    #endif
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -414,12 +616,28 @@ dispatch_loop:
                     DISPATCH();
                 }
 
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_ATTR_LOCAL_0):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    // Fall through to the generic opcode.
+                #endif
+
                 ENTRY(MP_BC_LOAD_ATTR): {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
+                    #if MICROPY_OPT_ATTR_INLINE_CACHE
+                    const byte *site = ip;
+                    #endif
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
                     mp_obj_t obj;
+                    #if MICROPY_OPT_ATTR_INLINE_CACHE
+                    obj = vm_load_attr_cached(site, top, qst);
+                    #else
                     #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
                     // For the specific case of an instance type, it implements .attr
                     // and forwards to its members map. Attribute lookups on instance
@@ -437,14 +655,31 @@ dispatch_loop:
                     {
                         obj = mp_load_attr(top, qst);
                     }
+                    #endif
                     SET_TOP(obj);
                     DISPATCH();
                 }
 
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_METHOD_LOCAL_0):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    // Fall through to the generic opcode.
+                #endif
+
                 ENTRY(MP_BC_LOAD_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
+                    #if MICROPY_OPT_ATTR_INLINE_CACHE
+                    const byte *site = ip;
+                    DECODE_QSTR;
+                    vm_load_method_cached(site, *sp, qst, sp);
+                    #else
                     DECODE_QSTR;
                     mp_load_method(*sp, qst, sp);
+                    #endif
                     sp += 1;
                     DISPATCH();
                 }
@@ -495,11 +730,27 @@ dispatch_loop:
                     DISPATCH();
                 }
 
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_STORE_ATTR_LOCAL_0):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    // Fall through to the generic opcode.
+                #endif
+
                 ENTRY(MP_BC_STORE_ATTR): {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
+                    #if MICROPY_OPT_ATTR_INLINE_CACHE
+                    const byte *site = ip;
+                    DECODE_QSTR;
+                    vm_store_attr_cached(site, sp[0], qst, sp[-1]);
+                    #else
                     DECODE_QSTR;
                     mp_store_attr(sp[0], qst, sp[-1]);
+                    #endif
                     sp -= 2;
                     DISPATCH();
                 }
@@ -1284,6 +1535,71 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_BINARY_OP_POP_JUMP_IF): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_SLABEL;
+                    // The offset is relative to the byte holding the op and condition.
+                    mp_uint_t op = *ip & 0x7f;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    bool cond;
+                    if (op <= MP_BINARY_OP_NOT_EQUAL && mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        cond = vm_small_int_compare(op, lhs, rhs);
+                    } else {
+                        cond = mp_obj_is_true(mp_binary_op(op, lhs, rhs));
+                    }
+                    if (cond == (*ip >> 7)) {
+                        ip += slab;
+                    } else {
+                        ip += 1;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+                #endif
+
+                #if MICROPY_OPT_BC_QUICKEN
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_LESS):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MORE):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_EQUAL):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_LESS_EQUAL):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MORE_EQUAL):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_NOT_EQUAL): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_uint_t op = vm_quickened_binary_op[ip[-1] - MP_BC_BINARY_OP_SMALL_INT_LESS];
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        SET_TOP(mp_obj_new_bool(vm_small_int_compare(op, lhs, rhs)));
+                    } else {
+                        SET_TOP(mp_binary_op(op, lhs, rhs));
+                    }
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_ADD):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_SUBTRACT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_uint_t op = vm_quickened_binary_op[ip[-1] - MP_BC_BINARY_OP_SMALL_INT_LESS];
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+                        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+                        // Small ints have at least one spare bit, so this can't overflow.
+                        mp_int_t res = (op == MP_BINARY_OP_INPLACE_ADD || op == MP_BINARY_OP_ADD) ? lhs_val + rhs_val : lhs_val - rhs_val;
+                        if (MP_SMALL_INT_FITS(res)) {
+                            SET_TOP(MP_OBJ_NEW_SMALL_INT(res));
+                            DISPATCH();
+                        }
+                    }
+                    SET_TOP(mp_binary_op(op, lhs, rhs));
+                    DISPATCH();
+                }
+                #endif
+
                 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
@@ -1304,9 +1620,15 @@ yield:
 
                 ENTRY(MP_BC_BINARY_OP_MULTI): {
                     MARK_EXC_IP_SELECTIVE();
+                    mp_uint_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    #if MICROPY_OPT_BC_QUICKEN
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        vm_quicken_binary_op(ip - 1, op);
+                    }
+                    #endif
+                    SET_TOP(mp_binary_op(op, lhs, rhs));
                     DISPATCH();
                 }
 
@@ -1327,9 +1649,15 @@ yield:
                         SET_TOP(mp_unary_op(ip[-1] - MP_BC_UNARY_OP_MULTI, TOP()));
                         DISPATCH();
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
+                        mp_uint_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        #if MICROPY_OPT_BC_QUICKEN
+                        if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                            vm_quicken_binary_op(ip - 1, op);
+                        }
+                        #endif
+                        SET_TOP(mp_binary_op(op, lhs, rhs));
                         DISPATCH();
                     } else
                 #endif // MICROPY_OPT_COMPUTED_GOTO
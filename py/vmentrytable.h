@@ -127,6 +127,24 @@ static entry_table_type const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_IMPORT_NAME] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_NAME),
     [MP_BC_IMPORT_FROM] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_FROM),
     [MP_BC_IMPORT_STAR] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_STAR),
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    [MP_BC_LOAD_ATTR_LOCAL_0] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_ATTR_LOCAL_0),
+    [MP_BC_LOAD_METHOD_LOCAL_0] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_METHOD_LOCAL_0),
+    [MP_BC_STORE_ATTR_LOCAL_0] = COMPUTE_ENTRY(&& entry_MP_BC_STORE_ATTR_LOCAL_0),
+    [MP_BC_BINARY_OP_POP_JUMP_IF] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_POP_JUMP_IF),
+    #endif
+    #if MICROPY_OPT_BC_QUICKEN
+    [MP_BC_BINARY_OP_SMALL_INT_LESS] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_LESS),
+    [MP_BC_BINARY_OP_SMALL_INT_MORE] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_MORE),
+    [MP_BC_BINARY_OP_SMALL_INT_EQUAL] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_EQUAL),
+    [MP_BC_BINARY_OP_SMALL_INT_LESS_EQUAL] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_LESS_EQUAL),
+    [MP_BC_BINARY_OP_SMALL_INT_MORE_EQUAL] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_MORE_EQUAL),
+    [MP_BC_BINARY_OP_SMALL_INT_NOT_EQUAL] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_NOT_EQUAL),
+    [MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD),
+    [MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT),
+    [MP_BC_BINARY_OP_SMALL_INT_ADD] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_ADD),
+    [MP_BC_BINARY_OP_SMALL_INT_SUBTRACT] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_SMALL_INT_SUBTRACT),
+    #endif
     [MP_BC_LOAD_CONST_SMALL_INT_MULTI ... MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_CONST_SMALL_INT_MULTI),
     [MP_BC_LOAD_FAST_MULTI ... MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_MULTI),
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_STORE_FAST_MULTI),
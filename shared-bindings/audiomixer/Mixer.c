@@ -26,16 +26,21 @@
 //|         bits_per_sample: int = 16,
 //|         samples_signed: bool = True,
 //|         sample_rate: int = 8000,
+//|         resample_quality: int = 1,
 //|     ) -> None:
-//|         """Create a Mixer object that can mix multiple channels with the same sample rate.
+//|         """Create a Mixer object that can mix multiple channels together.
 //|         Samples are accessed and controlled with the mixer's `audiomixer.MixerVoice` objects.
+//|         Samples with a different sample rate are converted to the mixer's rate as they play.
 //|
 //|         :param int voice_count: The maximum number of voices to mix
 //|         :param int buffer_size: The total size in bytes of the buffers to mix into
 //|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
 //|         :param int bits_per_sample: The bits per sample of the samples being played
 //|         :param bool samples_signed: Samples are signed (True) or unsigned (False)
-//|         :param int sample_rate: The sample rate to be used for all samples
+//|         :param int sample_rate: The sample rate of the mixer's output
+//|         :param int resample_quality: How carefully samples at other rates are converted, from 0 to 2.
+//|           0 interpolates linearly, which is cheapest but adds noise and aliasing. 1 and 2 use
+//|           8 and 16 tap filters, trading more CPU time for a cleaner sound.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -63,7 +68,7 @@
 //|           print("stopped")"""
 //|         ...
 static mp_obj_t audiomixer_mixer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_voice_count, ARG_buffer_size, ARG_channel_count, ARG_bits_per_sample, ARG_samples_signed, ARG_sample_rate };
+    enum { ARG_voice_count, ARG_buffer_size, ARG_channel_count, ARG_bits_per_sample, ARG_samples_signed, ARG_sample_rate, ARG_resample_quality };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_voice_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 2} },
         { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
@@ -71,6 +76,7 @@ static mp_obj_t audiomixer_mixer_make_new(const mp_obj_type_t *type, size_t n_ar
         { MP_QSTR_bits_per_sample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
         { MP_QSTR_samples_signed, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_resample_quality, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -78,13 +84,14 @@ static mp_obj_t audiomixer_mixer_make_new(const mp_obj_type_t *type, size_t n_ar
     mp_int_t voice_count = mp_arg_validate_int_range(args[ARG_voice_count].u_int, 1, 255, MP_QSTR_voice_count);
     mp_int_t channel_count = mp_arg_validate_int_range(args[ARG_channel_count].u_int, 1, 2, MP_QSTR_channel_count);
     mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t resample_quality = mp_arg_validate_int_range(args[ARG_resample_quality].u_int, 0, AUDIOMIXER_RESAMPLE_MAX_QUALITY, MP_QSTR_resample_quality);
     mp_int_t bits_per_sample = args[ARG_bits_per_sample].u_int;
     if (bits_per_sample != 8 && bits_per_sample != 16) {
         mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
     }
     audiomixer_mixer_obj_t *self =
         mp_obj_malloc_var(audiomixer_mixer_obj_t, voice, mp_obj_t, voice_count, &audiomixer_mixer_type);
-    common_hal_audiomixer_mixer_construct(self, voice_count, args[ARG_buffer_size].u_int, bits_per_sample, args[ARG_samples_signed].u_bool, channel_count, sample_rate);
+    common_hal_audiomixer_mixer_construct(self, voice_count, args[ARG_buffer_size].u_int, bits_per_sample, args[ARG_samples_signed].u_bool, channel_count, sample_rate, resample_quality);
 
     for (int v = 0; v < voice_count; v++) {
         self->voice[v] = MP_OBJ_TYPE_GET_SLOT(&audiomixer_mixervoice_type, make_new)(&audiomixer_mixervoice_type, 0, 0, NULL);
@@ -176,7 +183,8 @@ MP_PROPERTY_GETTER(audiomixer_mixer_voice_obj,
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the Mixer's encoding settings given in the constructor."""
+//|         The sample must match the Mixer's encoding settings given in the constructor,
+//|         except for its sample rate."""
 //|         ...
 static mp_obj_t audiomixer_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_sample, ARG_voice, ARG_loop };
@@ -17,7 +17,8 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t bits_per_sample,
     bool samples_signed,
     uint8_t channel_count,
-    uint32_t sample_rate);
+    uint32_t sample_rate,
+    uint8_t resample_quality);
 
 void common_hal_audiomixer_mixer_deinit(audiomixer_mixer_obj_t *self);
 bool common_hal_audiomixer_mixer_deinited(audiomixer_mixer_obj_t *self);
@@ -390,6 +390,26 @@ MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_bus_obj, busdisplay_busdispl
 MP_PROPERTY_GETTER(busdisplay_busdisplay_bus_obj,
     (mp_obj_t)&busdisplay_busdisplay_get_bus_obj);
 
+//|     refresh_stats: Tuple[int, int, int]
+//|     """Timing of the last refresh that changed the display, in microseconds, as
+//|     ``(frame_time, fill_time, bus_time)``. ``fill_time`` is spent compositing pixels and
+//|     ``bus_time`` sending them or waiting for the bus. On buses that send in the background,
+//|     ``frame_time`` is less than their sum by the time the two overlapped."""
+static mp_obj_t busdisplay_busdisplay_obj_get_refresh_stats(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    const busdisplay_refresh_stats_t *stats = common_hal_busdisplay_busdisplay_get_refresh_stats(self);
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(stats->frame_us),
+        mp_obj_new_int_from_uint(stats->fill_us),
+        mp_obj_new_int_from_uint(stats->bus_us),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_refresh_stats_obj, busdisplay_busdisplay_obj_get_refresh_stats);
+
+MP_PROPERTY_GETTER(busdisplay_busdisplay_refresh_stats_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_refresh_stats_obj);
+
 //|     root_group: displayio.Group
 //|     """The root group on the display.
 //|     If the root group is set to `displayio.CIRCUITPYTHON_TERMINAL`, the default CircuitPython terminal will be shown.
@@ -490,6 +510,7 @@ static const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&busdisplay_busdisplay_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&busdisplay_busdisplay_rotation_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&busdisplay_busdisplay_bus_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_stats), MP_ROM_PTR(&busdisplay_busdisplay_refresh_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&busdisplay_busdisplay_root_group_obj) },
 };
 static MP_DEFINE_CONST_DICT(busdisplay_busdisplay_locals_dict, busdisplay_busdisplay_locals_dict_table);
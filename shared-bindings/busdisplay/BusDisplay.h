@@ -43,5 +43,6 @@ mp_float_t common_hal_busdisplay_busdisplay_get_brightness(busdisplay_busdisplay
 bool common_hal_busdisplay_busdisplay_set_brightness(busdisplay_busdisplay_obj_t *self, mp_float_t brightness);
 
 mp_obj_t common_hal_busdisplay_busdisplay_get_bus(busdisplay_busdisplay_obj_t *self);
+const busdisplay_refresh_stats_t *common_hal_busdisplay_busdisplay_get_refresh_stats(busdisplay_busdisplay_obj_t *self);
 mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_obj_t *self);
 mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_obj_t *self, displayio_group_t *root_group);
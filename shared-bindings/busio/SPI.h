@@ -31,6 +31,12 @@ extern void common_hal_busio_spi_unlock(busio_spi_obj_t *self);
 // Writes out the given data.
 extern bool common_hal_busio_spi_write(busio_spi_obj_t *self, const uint8_t *data, size_t len);
 
+// Starts writing out the given data and may return before it has all been sent. data must not
+// change until common_hal_busio_spi_wait_for_write returns. Only ports that set
+// CIRCUITPY_BUSIO_SPI_NONBLOCKING implement these.
+extern bool common_hal_busio_spi_write_nonblocking(busio_spi_obj_t *self, const uint8_t *data, size_t len);
+extern void common_hal_busio_spi_wait_for_write(busio_spi_obj_t *self);
+
 // Reads in len bytes while outputting the byte write_value.
 extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value);
 
@@ -14,8 +14,8 @@
 #include "shared-bindings/displayio/OnDiskBitmap.h"
 
 //| class OnDiskBitmap:
-//|     """Loads values straight from disk. This minimizes memory use but can lead to
-//|     much slower pixel load times. These load times may result in frame tearing where only part of
+//|     """Loads values straight from disk, a few rows at a time. This minimizes memory use but
+//|     can lead to much slower pixel load times. These load times may result in frame tearing where only part of
 //|     the image is visible.
 //|
 //|     It's easiest to use on a board with a built in display such as the `Hallowing M0 Express
@@ -65,7 +65,7 @@ static mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
-    if (!mp_obj_is_type(arg, &mp_type_fileio)) {
+    if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
 
@@ -116,8 +116,63 @@ MP_DEFINE_CONST_FUN_OBJ_1(displayio_ondiskbitmap_get_pixel_shader_obj, displayio
 MP_PROPERTY_GETTER(displayio_ondiskbitmap_pixel_shader_obj,
     (mp_obj_t)&displayio_ondiskbitmap_get_pixel_shader_obj);
 
+//|     def load(
+//|         self,
+//|         x1: int = 0,
+//|         y1: int = 0,
+//|         x2: Optional[int] = None,
+//|         y2: Optional[int] = None,
+//|         *,
+//|         step: int = 1,
+//|     ) -> Bitmap:
+//|         """Reads a region of the image into a new `Bitmap` in RAM. Drawing from the
+//|         returned bitmap is much faster than drawing from the file.
+//|
+//|         Indexed images keep their palette indices. Other images are loaded as RGB888
+//|         values. In both cases ``pixel_shader`` can be used to draw the result.
+//|
+//|         :param int x1: Left edge of the region
+//|         :param int y1: Top edge of the region
+//|         :param int x2: Right edge of the region (exclusive), or the image width if ``None``
+//|         :param int y2: Bottom edge of the region (exclusive), or the image height if ``None``
+//|         :param int step: Only keep every ``step``'th pixel in each direction, making a
+//|             smaller copy of the image"""
+//|         ...
+//|
+static mp_obj_t displayio_ondiskbitmap_obj_load(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_step };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x1, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y1, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_x2, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_y2, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_step, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    displayio_ondiskbitmap_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t width = common_hal_displayio_ondiskbitmap_get_width(self);
+    mp_int_t height = common_hal_displayio_ondiskbitmap_get_height(self);
+    mp_int_t x1 = mp_arg_validate_int_range(args[ARG_x1].u_int, 0, width - 1, MP_QSTR_x1);
+    mp_int_t y1 = mp_arg_validate_int_range(args[ARG_y1].u_int, 0, height - 1, MP_QSTR_y1);
+    mp_int_t x2 = width;
+    if (args[ARG_x2].u_obj != mp_const_none) {
+        x2 = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_x2].u_obj), x1 + 1, width, MP_QSTR_x2);
+    }
+    mp_int_t y2 = height;
+    if (args[ARG_y2].u_obj != mp_const_none) {
+        y2 = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_y2].u_obj), y1 + 1, height, MP_QSTR_y2);
+    }
+    mp_int_t step = mp_arg_validate_int_range(args[ARG_step].u_int, 1, 0xffff, MP_QSTR_step);
+
+    return common_hal_displayio_ondiskbitmap_load(self, x1, y1, x2, y2, step);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_ondiskbitmap_load_obj, 1, displayio_ondiskbitmap_obj_load);
+
 static const mp_rom_map_elem_t displayio_ondiskbitmap_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_ondiskbitmap_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&displayio_ondiskbitmap_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_pixel_shader), MP_ROM_PTR(&displayio_ondiskbitmap_pixel_shader_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_ondiskbitmap_width_obj) },
 };
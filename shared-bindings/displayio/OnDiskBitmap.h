@@ -18,4 +18,5 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *b
 
 uint16_t common_hal_displayio_ondiskbitmap_get_height(displayio_ondiskbitmap_t *self);
 mp_obj_t common_hal_displayio_ondiskbitmap_get_pixel_shader(displayio_ondiskbitmap_t *self);
+mp_obj_t common_hal_displayio_ondiskbitmap_load(displayio_ondiskbitmap_t *self, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t step);
 uint16_t common_hal_displayio_ondiskbitmap_get_width(displayio_ondiskbitmap_t *self);
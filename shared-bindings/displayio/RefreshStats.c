@@ -0,0 +1,180 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/displayio/RefreshStats.h"
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+
+//| class RefreshStats:
+//|     def __init__(self, *, max_layers: int = 16) -> None:
+//|         """Records where display refreshes spend their time. Nothing is recorded until it is
+//|         used as a context manager and only one RefreshStats can record at a time.
+//|
+//|         Times are in microseconds and are summed over every display refreshed while recording.
+//|         Compositing is the time spent filling buffers from the root group and transfer is the
+//|         time spent sending them to the display.
+//|
+//|         :param int max_layers: The number of TileGrids and vectorio shapes to time individually
+//|
+//|         Profile a refresh::
+//|
+//|           import displayio
+//|
+//|           stats = displayio.RefreshStats()
+//|           with stats:
+//|               display.refresh()
+//|
+//|           print(stats.frames, stats.composite_ticks, stats.transfer_ticks)
+//|           for layer, ticks in stats.layers:
+//|               print(layer, ticks)
+//|         """
+//|         ...
+//|
+static mp_obj_t displayio_refreshstats_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_max_layers };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_max_layers, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 16} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_refreshstats_t *self = mp_obj_malloc(displayio_refreshstats_t, &displayio_refreshstats_type);
+    common_hal_displayio_refreshstats_construct(self, mp_arg_validate_int_range(args[ARG_max_layers].u_int, 0, 255, MP_QSTR_max_layers));
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def __enter__(self) -> RefreshStats:
+//|         """Clears the counts and starts recording."""
+//|         ...
+//|
+static mp_obj_t displayio_refreshstats_obj___enter__(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_displayio_refreshstats_clear(self);
+    common_hal_displayio_refreshstats_resume(self);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats___enter___obj, displayio_refreshstats_obj___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Stops recording when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t displayio_refreshstats_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_displayio_refreshstats_pause(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio_refreshstats___exit___obj, 4, 4, displayio_refreshstats_obj___exit__);
+
+//|     frames: int
+//|     """Number of refreshes that had something to update"""
+static mp_obj_t displayio_refreshstats_obj_get_frames(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_refreshstats_get_frames(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_frames_obj, displayio_refreshstats_obj_get_frames);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_frames_obj,
+    (mp_obj_t)&displayio_refreshstats_get_frames_obj);
+
+//|     dirty_areas: int
+//|     """Number of dirty rectangles refreshed, summed over all frames"""
+static mp_obj_t displayio_refreshstats_obj_get_dirty_areas(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_refreshstats_get_dirty_areas(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_dirty_areas_obj, displayio_refreshstats_obj_get_dirty_areas);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_dirty_areas_obj,
+    (mp_obj_t)&displayio_refreshstats_get_dirty_areas_obj);
+
+//|     composite_ticks: int
+//|     """Microseconds spent compositing the root group into buffers"""
+static mp_obj_t displayio_refreshstats_obj_get_composite_ticks(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_refreshstats_get_composite_ticks(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_composite_ticks_obj, displayio_refreshstats_obj_get_composite_ticks);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_composite_ticks_obj,
+    (mp_obj_t)&displayio_refreshstats_get_composite_ticks_obj);
+
+//|     transfer_ticks: int
+//|     """Microseconds spent sending composited pixels to the display"""
+static mp_obj_t displayio_refreshstats_obj_get_transfer_ticks(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_refreshstats_get_transfer_ticks(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_transfer_ticks_obj, displayio_refreshstats_obj_get_transfer_ticks);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_transfer_ticks_obj,
+    (mp_obj_t)&displayio_refreshstats_get_transfer_ticks_obj);
+
+//|     pixels_composited: int
+//|     """Number of pixels composited"""
+static mp_obj_t displayio_refreshstats_obj_get_pixels_composited(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_refreshstats_get_pixels_composited(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_pixels_composited_obj, displayio_refreshstats_obj_get_pixels_composited);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_pixels_composited_obj,
+    (mp_obj_t)&displayio_refreshstats_get_pixels_composited_obj);
+
+//|     pixels_sent: int
+//|     """Number of pixels sent to the display"""
+static mp_obj_t displayio_refreshstats_obj_get_pixels_sent(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_refreshstats_get_pixels_sent(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_pixels_sent_obj, displayio_refreshstats_obj_get_pixels_sent);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_pixels_sent_obj,
+    (mp_obj_t)&displayio_refreshstats_get_pixels_sent_obj);
+
+//|     layers: Tuple[Tuple[Union[TileGrid, vectorio.Circle, vectorio.Rectangle, vectorio.Polygon], int], ...]
+//|     """``(layer, ticks)`` pairs with the microseconds spent compositing each TileGrid and vectorio
+//|     shape, in the order they were first drawn. Layers beyond ``max_layers`` are only counted in
+//|     `composite_ticks`."""
+//|
+static mp_obj_t displayio_refreshstats_obj_get_layers(mp_obj_t self_in) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_displayio_refreshstats_get_layers(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_refreshstats_get_layers_obj, displayio_refreshstats_obj_get_layers);
+
+MP_PROPERTY_GETTER(displayio_refreshstats_layers_obj,
+    (mp_obj_t)&displayio_refreshstats_get_layers_obj);
+
+static const mp_rom_map_elem_t displayio_refreshstats_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&displayio_refreshstats___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&displayio_refreshstats___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_frames), MP_ROM_PTR(&displayio_refreshstats_frames_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dirty_areas), MP_ROM_PTR(&displayio_refreshstats_dirty_areas_obj) },
+    { MP_ROM_QSTR(MP_QSTR_composite_ticks), MP_ROM_PTR(&displayio_refreshstats_composite_ticks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transfer_ticks), MP_ROM_PTR(&displayio_refreshstats_transfer_ticks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pixels_composited), MP_ROM_PTR(&displayio_refreshstats_pixels_composited_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pixels_sent), MP_ROM_PTR(&displayio_refreshstats_pixels_sent_obj) },
+    { MP_ROM_QSTR(MP_QSTR_layers), MP_ROM_PTR(&displayio_refreshstats_layers_obj) },
+};
+static MP_DEFINE_CONST_DICT(displayio_refreshstats_locals_dict, displayio_refreshstats_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    displayio_refreshstats_type,
+    MP_QSTR_RefreshStats,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, displayio_refreshstats_make_new,
+    locals_dict, &displayio_refreshstats_locals_dict
+    );
@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/displayio/RefreshStats.h"
+
+extern const mp_obj_type_t displayio_refreshstats_type;
+
+void common_hal_displayio_refreshstats_construct(displayio_refreshstats_t *self, uint16_t max_layers);
+void common_hal_displayio_refreshstats_clear(displayio_refreshstats_t *self);
+void common_hal_displayio_refreshstats_resume(displayio_refreshstats_t *self);
+void common_hal_displayio_refreshstats_pause(displayio_refreshstats_t *self);
+
+uint32_t common_hal_displayio_refreshstats_get_frames(displayio_refreshstats_t *self);
+uint32_t common_hal_displayio_refreshstats_get_dirty_areas(displayio_refreshstats_t *self);
+uint32_t common_hal_displayio_refreshstats_get_composite_ticks(displayio_refreshstats_t *self);
+uint32_t common_hal_displayio_refreshstats_get_transfer_ticks(displayio_refreshstats_t *self);
+uint32_t common_hal_displayio_refreshstats_get_pixels_composited(displayio_refreshstats_t *self);
+uint32_t common_hal_displayio_refreshstats_get_pixels_sent(displayio_refreshstats_t *self);
+mp_obj_t common_hal_displayio_refreshstats_get_layers(displayio_refreshstats_t *self);
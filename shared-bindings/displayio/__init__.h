@@ -45,5 +45,7 @@ typedef bool (*display_bus_bus_free)(mp_obj_t bus);
 typedef bool (*display_bus_begin_transaction)(mp_obj_t bus);
 typedef void (*display_bus_send)(mp_obj_t bus, display_byte_type_t byte_type,
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
+typedef void (*display_bus_send_nonblocking)(mp_obj_t bus, const uint8_t *data, uint32_t data_length);
+typedef void (*display_bus_wait_for_send)(mp_obj_t bus);
 typedef void (*display_bus_end_transaction)(mp_obj_t bus);
 typedef void (*display_bus_collect_ptrs)(mp_obj_t bus);
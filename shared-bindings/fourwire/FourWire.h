@@ -30,6 +30,11 @@ bool common_hal_fourwire_fourwire_begin_transaction(mp_obj_t self);
 void common_hal_fourwire_fourwire_send(mp_obj_t self, display_byte_type_t byte_type,
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
 
+// Starts sending pixel data and may return before it has all been sent. Only built when
+// CIRCUITPY_BUSIO_SPI_NONBLOCKING is set.
+void common_hal_fourwire_fourwire_send_nonblocking(mp_obj_t self, const uint8_t *data, uint32_t data_length);
+void common_hal_fourwire_fourwire_wait_for_send(mp_obj_t self);
+
 void common_hal_fourwire_fourwire_end_transaction(mp_obj_t self);
 
 // The FourWire object always lives off the MP heap. So, code must collect any pointers
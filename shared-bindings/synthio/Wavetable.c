@@ -0,0 +1,86 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Wavetable.h"
+#include "shared-module/synthio/__init__.h"
+
+//| class Wavetable:
+//|     """A band-limited version of a single-cycle waveform
+//|
+//|     A `Wavetable` can be used anywhere a waveform is accepted. When a `Note`
+//|     or `Synthesizer` plays it over its whole length, each note reads a copy
+//|     that has had the harmonics above the Nyquist frequency removed, and
+//|     interpolates between its samples. High notes on square and sawtooth waves
+//|     then play without aliasing, and short waveforms sound as clean as long ones.
+//|
+//|     Everywhere else, such as in ``ring_waveform`` or when
+//|     ``waveform_loop_start`` or ``waveform_loop_end`` select part of it, it
+//|     behaves as a read-only array of type 'h' holding the first copy."""
+//|
+//|     def __init__(self, waveform: ReadableBuffer, *, cubic: bool = False) -> None:
+//|         """Create a Wavetable from one cycle of a waveform
+//|
+//|         The copies are computed once, when the Wavetable is created. Together they
+//|         hold four to eight times as many samples as ``waveform``, and at most about 8192.
+//|
+//|         :param ReadableBuffer waveform: One cycle of the waveform, an array of type 'h' (signed 16 bit)
+//|         :param bool cubic: Interpolate with a cubic spline instead of a straight line. This is
+//|           smoother, especially for low notes, but takes more CPU time.
+//|         """
+static mp_obj_t synthio_wavetable_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_waveform, ARG_cubic };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_cubic, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    synthio_synth_parse_waveform(&bufinfo, args[ARG_waveform].u_obj);
+
+    synthio_wavetable_obj_t *self = mp_obj_malloc(synthio_wavetable_obj_t, &synthio_wavetable_type);
+    common_hal_synthio_wavetable_construct(self, bufinfo.buf, bufinfo.len, args[ARG_cubic].u_bool);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     cubic: bool
+//|     """True if the wavetable is read with cubic interpolation. (read-only)"""
+//|
+static mp_obj_t synthio_wavetable_get_cubic(mp_obj_t self_in) {
+    synthio_wavetable_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_synthio_wavetable_get_cubic(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_wavetable_get_cubic_obj, synthio_wavetable_get_cubic);
+
+MP_PROPERTY_GETTER(synthio_wavetable_cubic_obj,
+    (mp_obj_t)&synthio_wavetable_get_cubic_obj);
+
+// (the get_buffer protocol returns 0 for success, 1 for failure)
+static mp_int_t synthio_wavetable_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    synthio_wavetable_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_wavetable_get_buffer(self, bufinfo);
+    return 0;
+}
+
+static const mp_rom_map_elem_t synthio_wavetable_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_cubic), MP_ROM_PTR(&synthio_wavetable_cubic_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_wavetable_locals_dict, synthio_wavetable_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_wavetable_type,
+    MP_QSTR_Wavetable,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_wavetable_make_new,
+    locals_dict, &synthio_wavetable_locals_dict,
+    buffer, synthio_wavetable_get_buffer
+    );
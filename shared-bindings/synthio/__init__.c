@@ -23,6 +23,7 @@
 #include "shared-bindings/synthio/MidiTrack.h"
 #include "shared-bindings/synthio/Note.h"
 #include "shared-bindings/synthio/Synthesizer.h"
+#include "shared-bindings/synthio/Wavetable.h"
 
 #include "shared-module/synthio/LFO.h"
 
@@ -317,6 +318,7 @@ static const mp_rom_map_elem_t synthio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_EnvelopeState), MP_ROM_PTR(&synthio_note_state_type) },
     { MP_ROM_QSTR(MP_QSTR_LFO), MP_ROM_PTR(&synthio_lfo_type) },
     { MP_ROM_QSTR(MP_QSTR_Synthesizer), MP_ROM_PTR(&synthio_synthesizer_type) },
+    { MP_ROM_QSTR(MP_QSTR_Wavetable), MP_ROM_PTR(&synthio_wavetable_type) },
     { MP_ROM_QSTR(MP_QSTR_from_file), MP_ROM_PTR(&synthio_from_file_obj) },
     { MP_ROM_QSTR(MP_QSTR_Envelope), MP_ROM_PTR(&synthio_envelope_type_obj) },
     { MP_ROM_QSTR(MP_QSTR_midi_to_hz), MP_ROM_PTR(&synthio_midi_to_hz_obj) },
@@ -17,6 +17,7 @@ void common_hal_vectorio_polygon_set_on_dirty(vectorio_polygon_t *self, vectorio
 
 
 uint32_t common_hal_vectorio_polygon_get_pixel(void *polygon, int16_t x, int16_t y);
+uint16_t common_hal_vectorio_polygon_get_spans(void *polygon, int16_t y, vectorio_span_t *spans, uint16_t max_spans);
 
 void common_hal_vectorio_polygon_get_area(void *polygon, displayio_area_t *out_area);
 
@@ -39,14 +39,17 @@ mp_obj_t vectorio_vector_shape_make_new(const mp_obj_t shape, const mp_obj_t pix
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_polygon_get_area;
         ishape.get_pixel = &common_hal_vectorio_polygon_get_pixel;
+        ishape.get_spans = &common_hal_vectorio_polygon_get_spans;
     } else if (mp_obj_is_type(shape, &vectorio_rectangle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_rectangle_get_area;
         ishape.get_pixel = &common_hal_vectorio_rectangle_get_pixel;
+        ishape.get_spans = &common_hal_vectorio_rectangle_get_spans;
     } else if (mp_obj_is_type(shape, &vectorio_circle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_circle_get_area;
         ishape.get_pixel = &common_hal_vectorio_circle_get_pixel;
+        ishape.get_spans = &common_hal_vectorio_circle_get_spans;
     } else {
         mp_raise_TypeError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_shape);
     }
@@ -82,6 +85,7 @@ vectorio_draw_protocol_impl_t vectorio_vector_shape_draw_protocol_impl = {
     .draw_finish_refresh = (draw_finish_refresh_fun)vectorio_vector_shape_finish_refresh,
     .draw_get_refresh_areas = (draw_get_refresh_areas_fun)vectorio_vector_shape_get_refresh_areas,
     .draw_set_dirty = (draw_set_dirty_fun)common_hal_vectorio_vector_shape_set_dirty,
+    .draw_get_bounds = (draw_get_bounds_fun)vectorio_vector_shape_get_bounds,
 };
 
 // Stub checker does not approve of these shared properties.
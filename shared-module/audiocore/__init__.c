@@ -7,6 +7,7 @@
 #include "shared-module/audioio/__init__.h"
 
 #include "py/obj.h"
+#include "py/runtime.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-module/audiocore/RawSample.h"
@@ -51,6 +52,65 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel_o
         samples_signed, max_buffer_length, spacing);
 }
 
+void audiosample_must_match(mp_obj_t sample_obj, uint32_t sample_rate, uint8_t channel_count,
+    uint8_t bits_per_sample, bool samples_signed) {
+    if (audiosample_sample_rate(sample_obj) != sample_rate) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_sample_rate);
+    }
+    if (audiosample_channel_count(sample_obj) != channel_count) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_channel_count);
+    }
+    if (audiosample_bits_per_sample(sample_obj) != bits_per_sample) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_bits_per_sample);
+    }
+    bool single_buffer;
+    bool sample_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample_obj, false, &single_buffer, &sample_signed, &max_buffer_length, &spacing);
+    if (sample_signed != samples_signed) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_signedness);
+    }
+}
+
+void audiosample_reader_init(audiosample_reader_t *self, uint8_t bits_per_sample) {
+    self->sample = NULL;
+    self->remaining_buffer = NULL;
+    self->remaining_length = 0;
+    self->bytes_per_sample = bits_per_sample / 8;
+    self->loop = false;
+    self->more_data = false;
+}
+
+static void audiosample_reader_load(audiosample_reader_t *self) {
+    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &self->remaining_buffer, &self->remaining_length);
+    self->remaining_length /= self->bytes_per_sample;
+    self->more_data = result == GET_BUFFER_MORE_DATA;
+}
+
+void audiosample_reader_play(audiosample_reader_t *self, mp_obj_t sample_obj, bool loop) {
+    self->sample = sample_obj;
+    self->loop = loop;
+    audiosample_reset_buffer(sample_obj, false, 0);
+    audiosample_reader_load(self);
+}
+
+void audiosample_reader_refill(audiosample_reader_t *self) {
+    if (self->remaining_length != 0) {
+        return;
+    }
+    if (!self->more_data) {
+        if (self->loop && self->sample) {
+            audiosample_reset_buffer(self->sample, false, 0);
+        } else {
+            self->sample = NULL;
+        }
+    }
+    if (self->sample) {
+        audiosample_reader_load(self);
+    }
+}
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
         int16_t sample = (*buffer_in++ - 0x80) << 8;
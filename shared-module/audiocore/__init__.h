@@ -53,6 +53,37 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel_o
     bool *single_buffer, bool *samples_signed,
     uint32_t *max_buffer_length, uint8_t *spacing);
 
+// Raises ValueError unless the sample has exactly this format. Distortion,
+// Filter and Echo read their input's buffers in place, so this is checked
+// once, when a sample starts playing, instead of converting while it plays.
+// MixerVoice checks its own format because it can resample.
+void audiosample_must_match(mp_obj_t sample_obj, uint32_t sample_rate, uint8_t channel_count,
+    uint8_t bits_per_sample, bool samples_signed);
+
+// The input side of an effect: the sample it is playing and how much of the
+// sample's last buffer the effect has yet to process.
+typedef struct {
+    mp_obj_t sample; // NULL when nothing is playing
+    uint8_t *remaining_buffer;
+    uint32_t remaining_length; // in samples
+    uint8_t bytes_per_sample;
+    bool loop;
+    bool more_data;
+} audiosample_reader_t;
+
+void audiosample_reader_init(audiosample_reader_t *self, uint8_t bits_per_sample);
+// Starts reading a sample from the beginning. Check its format first.
+void audiosample_reader_play(audiosample_reader_t *self, mp_obj_t sample_obj, bool loop);
+// Once the current buffer has been processed, loads the sample's next one,
+// going back to the start of a looping sample. When a sample that doesn't
+// loop finishes, self->sample becomes NULL.
+void audiosample_reader_refill(audiosample_reader_t *self);
+
+static inline void audiosample_reader_advance(audiosample_reader_t *self, uint32_t n) {
+    self->remaining_buffer += n * self->bytes_per_sample;
+    self->remaining_length -= n;
+}
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_u8s_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_s8m_s16s(int16_t *buffer_out, const int8_t *buffer_in, size_t nframes);
@@ -31,11 +31,8 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
+    audiosample_reader_t input;
 
-    bool loop;
-    bool more_data;
     bool freq_shift; // does the echo shift frequencies if delay changes
 
     int8_t *echo_buffer;
@@ -48,8 +45,6 @@ typedef struct {
     uint32_t echo_buffer_rate; // words << 8
     uint32_t echo_buffer_left_pos; // words << 8
     uint32_t echo_buffer_right_pos; // words << 8
-
-    mp_obj_t sample;
 } audiodelays_echo_obj_t;
 
 void recalculate_delay(audiodelays_echo_obj_t *self, mp_float_t f_delay_ms);
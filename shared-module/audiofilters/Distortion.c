@@ -51,14 +51,18 @@ void common_hal_audiofilters_distortion_construct(audiofilters_distortion_obj_t
     }
     memset(self->buffer[1], 0, self->buffer_len);
 
+    // The waveshaper lookup table is filled in on first use, see distortion_get_lut()
+    self->lut = m_malloc(2 * DISTORTION_LUT_SIZE * sizeof(int32_t));
+    if (self->lut == NULL) {
+        common_hal_audiofilters_distortion_deinit(self);
+        m_malloc_fail(2 * DISTORTION_LUT_SIZE * sizeof(int32_t));
+    }
+    self->lut_valid = false;
+
     self->last_buf_idx = 1; // Which buffer to use first, toggle between 0 and 1
 
     // Initialize other values most effects will need.
-    self->sample = NULL; // The current playing sample
-    self->sample_remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
-    self->sample_buffer_length = 0; // How many samples do we have left to play (these may be 16 bit!)
-    self->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
-    self->more_data = false; // Is there still more data to read from the sample or did we finish
+    audiosample_reader_init(&self->input, self->bits_per_sample); // The sample being played, and how much of it is left to process
 
     // The below section sets up the effect's starting values.
 
@@ -81,6 +85,7 @@ bool common_hal_audiofilters_distortion_deinited(audiofilters_distortion_obj_t *
 void common_hal_audiofilters_distortion_deinit(audiofilters_distortion_obj_t *self) {
     self->buffer[0] = NULL;
     self->buffer[1] = NULL;
+    self->lut = NULL;
 }
 
 mp_obj_t common_hal_audiofilters_distortion_get_drive(audiofilters_distortion_obj_t *self) {
@@ -152,7 +157,7 @@ void audiofilters_distortion_reset_buffer(audiofilters_distortion_obj_t *self,
 }
 
 bool common_hal_audiofilters_distortion_get_playing(audiofilters_distortion_obj_t *self) {
-    return self->sample != NULL;
+    return self->input.sample != NULL;
 }
 
 void common_hal_audiofilters_distortion_play(audiofilters_distortion_obj_t *self, mp_obj_t sample, bool loop) {
@@ -160,41 +165,15 @@ void common_hal_audiofilters_distortion_play(audiofilters_distortion_obj_t *self
     // Then we reset the sample and get the first buffer to play
     // The get_buffer function will actually process that data
 
-    if (audiosample_sample_rate(sample) != self->sample_rate) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_sample_rate);
-    }
-    if (audiosample_channel_count(sample) != self->channel_count) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_channel_count);
-    }
-    if (audiosample_bits_per_sample(sample) != self->bits_per_sample) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_bits_per_sample);
-    }
-    bool single_buffer;
-    bool samples_signed;
-    uint32_t max_buffer_length;
-    uint8_t spacing;
-    audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
-    if (samples_signed != self->samples_signed) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_signedness);
-    }
-
-    self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(self->sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-
-    // Track remaining sample length in terms of bytes per sample
-    self->sample_buffer_length /= (self->bits_per_sample / 8);
-    // Store if we have more data in the sample to retrieve
-    self->more_data = result == GET_BUFFER_MORE_DATA;
+    audiosample_must_match(sample, self->sample_rate, self->channel_count, self->bits_per_sample, self->samples_signed);
+    audiosample_reader_play(&self->input, sample, loop);
 
     return;
 }
 
 void common_hal_audiofilters_distortion_stop(audiofilters_distortion_obj_t *self) {
     // When the sample is set to stop playing do any cleanup here
-    self->sample = NULL;
+    self->input.sample = NULL;
     return;
 }
 
@@ -202,6 +181,122 @@ static mp_float_t db_to_linear(mp_float_t value) {
     return MICROPY_FLOAT_C_FUN(exp)(value * MICROPY_FLOAT_CONST(0.11512925464970228420089957273422));
 }
 
+// Applies the effect to one sample after pre-gain, including post-gain and
+// soft clipping but not hard clipping. This is used directly while the settings are changing and to
+// fill in the lookup table once they settle.
+static int32_t distortion_shape(audiofilters_distortion_obj_t *self, mp_float_t drive, mp_float_t post_gain, uint32_t word_mask, int32_t word) {
+    // Apply bit mask before converting to float
+    if (self->mode == DISTORTION_MODE_LOFI) {
+        word = word & word_mask;
+    }
+
+    if (self->mode != DISTORTION_MODE_LOFI || self->soft_clip) {
+        // Convert sample to float
+        mp_float_t wordf = word / MICROPY_FLOAT_CONST(32768.0);
+
+        switch (self->mode) {
+            case DISTORTION_MODE_CLIP: {
+                wordf = MICROPY_FLOAT_C_FUN(pow)(MICROPY_FLOAT_C_FUN(fabs)(wordf), drive);
+                if (word < 0) {
+                    wordf *= MICROPY_FLOAT_CONST(-1.0);
+                }
+            } break;
+            case DISTORTION_MODE_LOFI:
+                break;
+            case DISTORTION_MODE_OVERDRIVE: {
+                wordf *= MICROPY_FLOAT_CONST(0.686306);
+                mp_float_t z = MICROPY_FLOAT_CONST(1.0) + MICROPY_FLOAT_C_FUN(exp)(MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_C_FUN(fabs)(wordf)) * MICROPY_FLOAT_CONST(-0.75));
+                mp_float_t word_exp = MICROPY_FLOAT_C_FUN(exp)(wordf);
+                wordf *= MICROPY_FLOAT_CONST(-1.0);
+                wordf = (word_exp - MICROPY_FLOAT_C_FUN(exp)(wordf * z)) / (word_exp + MICROPY_FLOAT_C_FUN(exp)(wordf));
+            } break;
+            case DISTORTION_MODE_WAVESHAPE: {
+                wordf = (MICROPY_FLOAT_CONST(1.0) + drive) * wordf / (MICROPY_FLOAT_CONST(1.0) + drive * MICROPY_FLOAT_C_FUN(fabs)(wordf));
+            } break;
+        }
+
+        // Apply post-gain
+        wordf = wordf * post_gain;
+
+        // Soft clip
+        if (self->soft_clip) {
+            if (wordf > 0) {
+                wordf = MICROPY_FLOAT_CONST(1.0) - MICROPY_FLOAT_C_FUN(exp)(-wordf);
+            } else {
+                wordf = MICROPY_FLOAT_CONST(-1.0) + MICROPY_FLOAT_C_FUN(exp)(wordf);
+            }
+        }
+
+        // Convert sample back to signed integer
+        word = (int32_t)(wordf * MICROPY_FLOAT_CONST(32767.0));
+    } else {
+        // Apply post-gain
+        word = (int32_t)(word * post_gain);
+    }
+    return word;
+}
+
+// The lookup table maps an input sample straight to its shaped output, with
+// pre-gain, post-gain and clipping folded in. The first half is for positive
+// samples and the second for negative ones. Like a float, each entry after the
+// first 64 covers 1/32 of an octave of the sample's magnitude, so the steep
+// low end of CLIP and the knee of OVERDRIVE are as finely resolved at any
+// pre-gain, and linear interpolation between entries stays within a few LSB.
+// Entries are stored before hard clipping, which is applied after
+// interpolating so that the corner where clipping starts stays sharp. They
+// saturate at 2^20 so that interpolating can't overflow.
+#define DISTORTION_LUT_LIMIT (1 << 20)
+
+static int32_t lut_input(int i) {
+    return i < 64 ? i : (32 + i % 32) << (i / 32 - 1);
+}
+
+static inline int32_t lut_lookup(const int32_t *lut, int32_t sample) {
+    if (sample < 0) {
+        lut += DISTORTION_LUT_SIZE;
+        sample = -sample;
+    }
+    if (sample < 64) {
+        return lut[sample];
+    }
+    uint32_t shift = 26 - __builtin_clz(sample);
+    const int32_t *entry = lut + (shift << 5) + (sample >> shift);
+    int32_t fraction = sample & ((1 << shift) - 1);
+    return entry[0] + (((entry[1] - entry[0]) * fraction) >> shift);
+}
+
+// Returns the lookup table for these settings, or NULL if each sample has to
+// be shaped directly. Filling the table takes about as long as shaping a
+// buffer, so it is only refilled once the settings have held steady for a
+// whole buffer, and not while a BlockInput keeps changing them. LOFI masks
+// bits after pre-gain, which the table can't represent, so it is always direct.
+static const int32_t *distortion_get_lut(audiofilters_distortion_obj_t *self, mp_float_t drive, mp_float_t pre_gain, mp_float_t post_gain) {
+    if (self->mode == DISTORTION_MODE_LOFI) {
+        return NULL;
+    }
+    if (drive != self->lut_drive || pre_gain != self->lut_pre_gain || post_gain != self->lut_post_gain
+        || self->mode != self->lut_mode || self->soft_clip != self->lut_soft_clip) {
+        self->lut_drive = drive;
+        self->lut_pre_gain = pre_gain;
+        self->lut_post_gain = post_gain;
+        self->lut_mode = self->mode;
+        self->lut_soft_clip = self->soft_clip;
+        self->lut_valid = false;
+        return NULL;
+    }
+    if (!self->lut_valid) {
+        for (int i = 0; i < DISTORTION_LUT_SIZE; i++) {
+            int32_t input = lut_input(i);
+            int32_t positive = distortion_shape(self, drive, post_gain, 0, (int32_t)(input * pre_gain));
+            int32_t negative = distortion_shape(self, drive, post_gain, 0, (int32_t)(-input * pre_gain));
+            self->lut[i] = MIN(positive, DISTORTION_LUT_LIMIT);
+            self->lut[DISTORTION_LUT_SIZE + i] = MAX(negative, -DISTORTION_LUT_LIMIT);
+        }
+        self->lut_valid = true;
+    }
+    return self->lut;
+}
+
 audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_distortion_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -216,24 +311,9 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
-        if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                // Track length in terms of words.
-                self->sample_buffer_length /= (self->bits_per_sample / 8);
-                self->more_data = result == GET_BUFFER_MORE_DATA;
-            }
-        }
+        audiosample_reader_refill(&self->input);
 
-        if (self->sample == NULL) {
+        if (self->input.sample == NULL) {
             if (self->samples_signed) {
                 memset(word_buffer, 0, length * (self->bits_per_sample / 8));
             } else {
@@ -256,10 +336,10 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
         } else {
             // we have a sample to play and apply effect
             // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
-            uint32_t n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->channel_count);
+            uint32_t n = MIN(MIN(self->input.remaining_length, length), SYNTHIO_MAX_DUR * self->channel_count);
 
-            int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
-            int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
+            int16_t *sample_src = (int16_t *)self->input.remaining_buffer; // for 16-bit samples
+            int8_t *sample_hsrc = (int8_t *)self->input.remaining_buffer; // for 8-bit samples
 
             // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
             shared_bindings_synthio_lfo_tick(self->sample_rate, n / self->channel_count);
@@ -287,6 +367,8 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
                     }
                 }
             } else {
+                const int32_t *lut = distortion_get_lut(self, drive, pre_gain, post_gain);
+                int32_t mix_scaled = (int32_t)(mix * MICROPY_FLOAT_CONST(32768.0));
                 for (uint32_t i = 0; i < n; i++) {
                     int32_t sample_word = 0;
                     if (MP_LIKELY(self->bits_per_sample == 16)) {
@@ -300,74 +382,30 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
                         }
                     }
 
-                    // Apply pre-gain
-                    int32_t word = (int32_t)(sample_word * pre_gain);
-
-                    // Apply bit mask before converting to float
-                    if (self->mode == DISTORTION_MODE_LOFI) {
-                        word = word & word_mask;
-                    }
-
-                    if (self->mode != DISTORTION_MODE_LOFI || self->soft_clip) {
-                        // Convert sample to float
-                        mp_float_t wordf = word / MICROPY_FLOAT_CONST(32768.0);
-
-                        switch (self->mode) {
-                            case DISTORTION_MODE_CLIP: {
-                                wordf = MICROPY_FLOAT_C_FUN(pow)(MICROPY_FLOAT_C_FUN(fabs)(wordf), drive);
-                                if (word < 0) {
-                                    wordf *= MICROPY_FLOAT_CONST(-1.0);
-                                }
-                            } break;
-                            case DISTORTION_MODE_LOFI:
-                                break;
-                            case DISTORTION_MODE_OVERDRIVE: {
-                                wordf *= MICROPY_FLOAT_CONST(0.686306);
-                                mp_float_t z = MICROPY_FLOAT_CONST(1.0) + MICROPY_FLOAT_C_FUN(exp)(MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_C_FUN(fabs)(wordf)) * MICROPY_FLOAT_CONST(-0.75));
-                                mp_float_t word_exp = MICROPY_FLOAT_C_FUN(exp)(wordf);
-                                wordf *= MICROPY_FLOAT_CONST(-1.0);
-                                wordf = (word_exp - MICROPY_FLOAT_C_FUN(exp)(wordf * z)) / (word_exp + MICROPY_FLOAT_C_FUN(exp)(wordf));
-                            } break;
-                            case DISTORTION_MODE_WAVESHAPE: {
-                                wordf = (MICROPY_FLOAT_CONST(1.0) + drive) * wordf / (MICROPY_FLOAT_CONST(1.0) + drive * MICROPY_FLOAT_C_FUN(fabs)(wordf));
-                            } break;
-                        }
-
-                        // Apply post-gain
-                        wordf = wordf * post_gain;
-
-                        // Soft clip
-                        if (self->soft_clip) {
-                            if (wordf > 0) {
-                                wordf = MICROPY_FLOAT_CONST(1.0) - MICROPY_FLOAT_C_FUN(exp)(-wordf);
-                            } else {
-                                wordf = MICROPY_FLOAT_CONST(-1.0) + MICROPY_FLOAT_C_FUN(exp)(wordf);
-                            }
-                        }
-
-                        // Convert sample back to signed integer
-                        word = (int32_t)(wordf * MICROPY_FLOAT_CONST(32767.0));
+                    int32_t word;
+                    if (lut) {
+                        word = lut_lookup(lut, sample_word);
                     } else {
-                        // Apply post-gain
-                        word = (int32_t)(word * post_gain);
+                        // Apply pre-gain
+                        word = distortion_shape(self, drive, post_gain, word_mask, (int32_t)(sample_word * pre_gain));
                     }
 
-                    // Hard clip
+                    // Hard clip, symmetrically so that a full scale result can't wrap around
                     if (!self->soft_clip) {
-                        word = MIN(MAX(word, -32767), 32768);
+                        word = MIN(MAX(word, -32767), 32767);
                     }
 
+                    int32_t mixed = (sample_word * (32768 - mix_scaled) + word * mix_scaled) >> 15;
                     if (MP_LIKELY(self->bits_per_sample == 16)) {
-                        word_buffer[i] = (int16_t)((sample_word * (MICROPY_FLOAT_CONST(1.0) - mix)) + (word * mix));
+                        word_buffer[i] = (int16_t)mixed;
                         if (!self->samples_signed) {
                             word_buffer[i] ^= 0x8000;
                         }
                     } else {
-                        int8_t mixed = (int8_t)((sample_word * (MICROPY_FLOAT_CONST(1.0) - mix)) + (word * mix));
                         if (self->samples_signed) {
-                            hword_buffer[i] = mixed;
+                            hword_buffer[i] = (int8_t)mixed;
                         } else {
-                            hword_buffer[i] = (uint8_t)mixed ^ 0x80;
+                            hword_buffer[i] = (uint8_t)(int8_t)mixed ^ 0x80;
                         }
                     }
                 }
@@ -377,8 +415,7 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
             length -= n;
             word_buffer += n;
             hword_buffer += n;
-            self->sample_remaining_buffer += (n * (self->bits_per_sample / 8));
-            self->sample_buffer_length -= n;
+            audiosample_reader_advance(&self->input, n);
         }
     }
 
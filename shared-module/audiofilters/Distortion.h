@@ -18,6 +18,10 @@ typedef enum {
     DISTORTION_MODE_WAVESHAPE,
 } audiofilters_distortion_mode;
 
+// Entries in each half of the waveshaper lookup table, see Distortion.c. The
+// last one is the upper neighbour that -32768 interpolates towards.
+#define DISTORTION_LUT_SIZE (354)
+
 extern const mp_obj_type_t audiofilters_distortion_type;
 
 typedef struct {
@@ -38,13 +42,16 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
-
-    bool loop;
-    bool more_data;
+    audiosample_reader_t input;
 
-    mp_obj_t sample;
+    // Waveshaper lookup table and the settings it was last requested for
+    int32_t *lut;
+    mp_float_t lut_drive;
+    mp_float_t lut_pre_gain;
+    mp_float_t lut_post_gain;
+    audiofilters_distortion_mode lut_mode;
+    bool lut_soft_clip;
+    bool lut_valid;
 } audiofilters_distortion_obj_t;
 
 void audiofilters_distortion_reset_buffer(audiofilters_distortion_obj_t *self,
@@ -40,11 +40,7 @@ void common_hal_audiofilters_filter_construct(audiofilters_filter_obj_t *self,
     memset(self->filter_buffer, 0, SYNTHIO_MAX_DUR * sizeof(int32_t));
 
     // Initialize other values most effects will need.
-    self->sample = NULL; // The current playing sample
-    self->sample_remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
-    self->sample_buffer_length = 0; // How many samples do we have left to play (these may be 16 bit!)
-    self->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
-    self->more_data = false; // Is there still more data to read from the sample or did we finish
+    audiosample_reader_init(&self->input, self->bits_per_sample); // The sample being played, and how much of it is left to process
 
     // The below section sets up the effect's starting values.
 
@@ -166,7 +162,7 @@ void audiofilters_filter_reset_buffer(audiofilters_filter_obj_t *self,
 }
 
 bool common_hal_audiofilters_filter_get_playing(audiofilters_filter_obj_t *self) {
-    return self->sample != NULL;
+    return self->input.sample != NULL;
 }
 
 void common_hal_audiofilters_filter_play(audiofilters_filter_obj_t *self, mp_obj_t sample, bool loop) {
@@ -174,41 +170,15 @@ void common_hal_audiofilters_filter_play(audiofilters_filter_obj_t *self, mp_obj
     // Then we reset the sample and get the first buffer to play
     // The get_buffer function will actually process that data
 
-    if (audiosample_sample_rate(sample) != self->sample_rate) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_sample_rate);
-    }
-    if (audiosample_channel_count(sample) != self->channel_count) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_channel_count);
-    }
-    if (audiosample_bits_per_sample(sample) != self->bits_per_sample) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_bits_per_sample);
-    }
-    bool single_buffer;
-    bool samples_signed;
-    uint32_t max_buffer_length;
-    uint8_t spacing;
-    audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
-    if (samples_signed != self->samples_signed) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_signedness);
-    }
-
-    self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(self->sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-
-    // Track remaining sample length in terms of bytes per sample
-    self->sample_buffer_length /= (self->bits_per_sample / 8);
-    // Store if we have more data in the sample to retrieve
-    self->more_data = result == GET_BUFFER_MORE_DATA;
+    audiosample_must_match(sample, self->sample_rate, self->channel_count, self->bits_per_sample, self->samples_signed);
+    audiosample_reader_play(&self->input, sample, loop);
 
     return;
 }
 
 void common_hal_audiofilters_filter_stop(audiofilters_filter_obj_t *self) {
     // When the sample is set to stop playing do any cleanup here
-    self->sample = NULL;
+    self->input.sample = NULL;
     return;
 }
 
@@ -231,24 +201,9 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
-        if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                // Track length in terms of words.
-                self->sample_buffer_length /= (self->bits_per_sample / 8);
-                self->more_data = result == GET_BUFFER_MORE_DATA;
-            }
-        }
+        audiosample_reader_refill(&self->input);
 
-        if (self->sample == NULL) {
+        if (self->input.sample == NULL) {
             // tick all block inputs
             shared_bindings_synthio_lfo_tick(self->sample_rate, length / self->channel_count);
             (void)synthio_block_slot_get(&self->mix);
@@ -271,10 +226,10 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
         } else {
             // we have a sample to play and filter
             // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
-            uint32_t n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->channel_count);
+            uint32_t n = MIN(MIN(self->input.remaining_length, length), SYNTHIO_MAX_DUR * self->channel_count);
 
-            int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
-            int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
+            int16_t *sample_src = (int16_t *)self->input.remaining_buffer; // for 16-bit samples
+            int8_t *sample_hsrc = (int8_t *)self->input.remaining_buffer; // for 8-bit samples
 
             // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
             shared_bindings_synthio_lfo_tick(self->sample_rate, n / self->channel_count);
@@ -336,8 +291,7 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
             length -= n;
             word_buffer += n;
             hword_buffer += n;
-            self->sample_remaining_buffer += (n * (self->bits_per_sample / 8));
-            self->sample_buffer_length -= n;
+            audiosample_reader_advance(&self->input, n);
         }
     }
 
@@ -32,15 +32,9 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
+    audiosample_reader_t input;
 
     int32_t *filter_buffer;
-
-    bool loop;
-    bool more_data;
-
-    mp_obj_t sample;
 } audiofilters_filter_obj_t;
 
 void reset_filter_states(audiofilters_filter_obj_t *self);
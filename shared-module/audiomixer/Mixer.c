@@ -22,7 +22,8 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t bits_per_sample,
     bool samples_signed,
     uint8_t channel_count,
-    uint32_t sample_rate) {
+    uint32_t sample_rate,
+    uint8_t resample_quality) {
     self->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
 
     self->first_buffer = m_malloc(self->len);
@@ -41,6 +42,7 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     self->samples_signed = samples_signed;
     self->channel_count = channel_count;
     self->sample_rate = sample_rate;
+    self->resample_quality = resample_quality;
     self->voice_count = voice_count;
 }
 
@@ -170,7 +172,15 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
     while (length != 0) {
-        if (voice->buffer_length == 0) {
+        if (voice->buffer_length == 0 && voice->resample) {
+            // Resampled voices are mixed from the resampler's output instead.
+            voice->buffer_length = audiomixer_resampler_fill(&voice->resampler, voice->sample, voice->loop);
+            voice->remaining_buffer = voice->resampler.buffer;
+            if (voice->buffer_length == 0) {
+                voice->sample = NULL;
+                break;
+            }
+        } else if (voice->buffer_length == 0) {
             if (!voice->more_data) {
                 if (voice->loop) {
                     audiosample_reset_buffer(voice->sample, false, 0);
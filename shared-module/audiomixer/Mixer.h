@@ -21,6 +21,7 @@ typedef struct {
     bool samples_signed;
     uint8_t channel_count;
     uint32_t sample_rate;
+    uint8_t resample_quality;
 
     uint32_t read_count;
     uint32_t left_read_count;
@@ -15,6 +15,8 @@
 
 void common_hal_audiomixer_mixervoice_construct(audiomixer_mixervoice_obj_t *self) {
     self->sample = NULL;
+    self->resample = false;
+    self->resampler.history = NULL;
     common_hal_audiomixer_mixervoice_set_level(self, mp_obj_new_float(1.0));
 }
 
@@ -47,9 +49,6 @@ void common_hal_audiomixer_mixervoice_set_loop(audiomixer_mixervoice_obj_t *self
 }
 
 void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_sample_rate);
-    }
     if (audiosample_channel_count(sample) != self->parent->channel_count) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_channel_count);
     }
@@ -65,14 +64,29 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp
     if (samples_signed != self->parent->samples_signed) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_signedness);
     }
-    self->sample = sample;
+    // Stop first so the mixer doesn't see the resampler half set up.
+    self->sample = NULL;
+    uint32_t sample_rate = audiosample_sample_rate(sample);
+    self->resample = sample_rate != self->parent->sample_rate;
+    if (self->resample) {
+        audiomixer_resampler_start(&self->resampler, self->parent->resample_quality,
+            sample_rate, self->parent->sample_rate, self->parent->channel_count,
+            self->parent->bits_per_sample, self->parent->samples_signed);
+    }
     self->loop = loop;
 
     audiosample_reset_buffer(sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
-    // Track length in terms of words.
-    self->buffer_length /= sizeof(uint32_t);
-    self->more_data = result == GET_BUFFER_MORE_DATA;
+    if (self->resample) {
+        // The resampler reads the sample itself as the mixer asks for data.
+        self->buffer_length = 0;
+        self->more_data = true;
+    } else {
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
+        // Track length in terms of words.
+        self->buffer_length /= sizeof(uint32_t);
+        self->more_data = result == GET_BUFFER_MORE_DATA;
+    }
+    self->sample = sample;
 }
 
 bool common_hal_audiomixer_mixervoice_get_playing(audiomixer_mixervoice_obj_t *self) {
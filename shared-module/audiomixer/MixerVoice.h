@@ -9,6 +9,7 @@
 
 #include "shared-module/audiomixer/__init__.h"
 #include "shared-module/audiomixer/Mixer.h"
+#include "shared-module/audiomixer/resample.h"
 #if CIRCUITPY_SYNTHIO
 #include "shared-module/synthio/block.h"
 #endif
@@ -19,6 +20,7 @@ typedef struct {
     mp_obj_t sample;
     bool loop;
     bool more_data;
+    bool resample;
     uint32_t *remaining_buffer;
     uint32_t buffer_length;
     #if CIRCUITPY_SYNTHIO
@@ -26,4 +28,5 @@ typedef struct {
     #else
     uint16_t level;
     #endif
+    audiomixer_resampler_t resampler;
 } audiomixer_mixervoice_obj_t;
@@ -0,0 +1,202 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-module/audiomixer/resample.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiocore/__init__.h"
+
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+#define RESAMPLE_MAX_TAPS (16)
+
+static const struct {
+    uint8_t taps;
+    uint8_t phase_bits;
+} resample_quality[AUDIOMIXER_RESAMPLE_MAX_QUALITY + 1] = {
+    { 2, 0 },
+    { 8, 5 },
+    { RESAMPLE_MAX_TAPS, 6 },
+};
+
+// Blackman windowed sinc, one row of taps per phase. Each row is normalized
+// so that a constant input comes out unchanged.
+static void make_filter(audiomixer_resampler_t *self, uint32_t output_rate) {
+    uint8_t taps = self->taps;
+    uint32_t phases = 1 << (32 - self->phase_shift);
+    mp_float_t half = taps / 2;
+    // Cut off a little below the lower of the two Nyquist frequencies.
+    mp_float_t cutoff = MICROPY_FLOAT_CONST(0.9);
+    if (output_rate < self->sample_rate) {
+        cutoff = cutoff * output_rate / self->sample_rate;
+    }
+    mp_float_t row[RESAMPLE_MAX_TAPS];
+    for (uint32_t p = 0; p < phases; p++) {
+        mp_float_t sum = 0;
+        for (uint8_t k = 0; k < taps; k++) {
+            mp_float_t t = k - (half - 1) - (mp_float_t)p / phases;
+            mp_float_t x = MP_PI * t / half;
+            mp_float_t window = MICROPY_FLOAT_CONST(0.42) + MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(x) + MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(2 * x);
+            mp_float_t sinc = cutoff;
+            if (t != 0) {
+                sinc = MICROPY_FLOAT_C_FUN(sin)(MP_PI * cutoff * t) / (MP_PI * t);
+            }
+            row[k] = sinc * window;
+            sum += row[k];
+        }
+        int16_t *coefficients = self->coefficients + p * taps;
+        for (uint8_t k = 0; k < taps; k++) {
+            int32_t c = (int32_t)MICROPY_FLOAT_C_FUN(nearbyint)(row[k] / sum * 32768);
+            coefficients[k] = MIN(c, INT16_MAX);
+        }
+    }
+}
+
+void audiomixer_resampler_start(audiomixer_resampler_t *self, uint8_t quality,
+    uint32_t sample_rate, uint32_t output_rate, uint8_t channel_count,
+    uint8_t bits_per_sample, bool samples_signed) {
+    uint8_t taps = resample_quality[quality].taps;
+    uint8_t phase_bits = resample_quality[quality].phase_bits;
+    bool same_layout = self->history != NULL && self->quality == quality && self->channel_count == channel_count;
+    if (!same_layout) {
+        size_t coefficient_count = quality == AUDIOMIXER_RESAMPLE_LINEAR ? 0 : taps << phase_bits;
+        size_t history_count = channel_count * 2 * taps;
+        size_t buffer_count = AUDIOMIXER_RESAMPLE_FRAMES * channel_count;
+        // Both counts above are even, so the buffer stays word aligned.
+        int16_t *storage = m_malloc((coefficient_count + history_count + buffer_count) * sizeof(int16_t));
+        self->coefficients = coefficient_count ? storage : NULL;
+        self->history = storage + coefficient_count;
+        self->buffer = (uint32_t *)(self->history + history_count);
+        self->quality = quality;
+        self->channel_count = channel_count;
+        self->taps = taps;
+        self->phase_shift = 32 - phase_bits;
+    }
+    if (!same_layout || self->sample_rate != sample_rate) {
+        self->sample_rate = sample_rate;
+        if (self->coefficients) {
+            make_filter(self, output_rate);
+        }
+    }
+    self->bits_per_sample = bits_per_sample;
+    self->samples_signed = samples_signed;
+    self->step = sample_rate / output_rate;
+    self->step_fraction = ((uint64_t)(sample_rate % output_rate) << 32) / output_rate;
+    self->position = 0;
+
+    memset(self->history, 0, channel_count * 2 * taps * sizeof(int16_t));
+    self->head = 0;
+    // Read far enough ahead that the first output frame lands on the first
+    // input frame, and play out the same distance past the end.
+    self->pending = taps / 2 + 1;
+    self->flush = taps / 2;
+    self->input = NULL;
+    self->input_length = 0;
+    self->more_data = true;
+}
+
+static bool load_input(audiomixer_resampler_t *self, mp_obj_t sample, bool loop, uint32_t frame_size) {
+    bool looped = false;
+    while (self->input_length < frame_size) {
+        if (!self->more_data) {
+            // Stop if a looping sample ends again without producing a frame.
+            if (!loop || looped) {
+                return false;
+            }
+            audiosample_reset_buffer(sample, false, 0);
+            looped = true;
+        }
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, &self->input, &self->input_length);
+        if (result == GET_BUFFER_ERROR) {
+            self->input_length = 0;
+            self->more_data = false;
+            return false;
+        }
+        self->more_data = result == GET_BUFFER_MORE_DATA;
+    }
+    return true;
+}
+
+static bool read_frames(audiomixer_resampler_t *self, mp_obj_t sample, bool loop) {
+    uint8_t channel_count = self->channel_count;
+    uint32_t frame_size = channel_count * self->bits_per_sample / 8;
+    uint8_t taps = self->taps;
+    for (; self->pending; self->pending--) {
+        int16_t frame[2] = { 0, 0 };
+        if (self->input_length >= frame_size || load_input(self, sample, loop, frame_size)) {
+            if (self->bits_per_sample == 16) {
+                int16_t *input = (int16_t *)self->input;
+                for (uint8_t c = 0; c < channel_count; c++) {
+                    frame[c] = self->samples_signed ? input[c] : (int16_t)(input[c] ^ 0x8000);
+                }
+            } else {
+                for (uint8_t c = 0; c < channel_count; c++) {
+                    uint8_t value = self->samples_signed ? self->input[c] : self->input[c] ^ 0x80;
+                    frame[c] = (int16_t)((int8_t)value * 256);
+                }
+            }
+            self->input += frame_size;
+            self->input_length -= frame_size;
+        } else if (self->flush > 0) {
+            self->flush--;
+        } else {
+            return false;
+        }
+        uint8_t head = self->head;
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int16_t *history = self->history + c * 2 * taps;
+            history[head] = history[head + taps] = frame[c];
+        }
+        self->head = head + 1 == taps ? 0 : head + 1;
+    }
+    return true;
+}
+
+static inline void store(audiomixer_resampler_t *self, uint32_t index, int32_t value) {
+    if (self->bits_per_sample == 16) {
+        ((int16_t *)self->buffer)[index] = self->samples_signed ? value : value ^ 0x8000;
+    } else {
+        ((int8_t *)self->buffer)[index] = self->samples_signed ? value >> 8 : (value >> 8) ^ 0x80;
+    }
+}
+
+uint32_t audiomixer_resampler_fill(audiomixer_resampler_t *self, mp_obj_t sample, bool loop) {
+    uint8_t channel_count = self->channel_count;
+    uint8_t taps = self->taps;
+    uint32_t index = 0;
+    for (uint32_t frame = 0; frame < AUDIOMIXER_RESAMPLE_FRAMES && read_frames(self, sample, loop); frame++) {
+        const int16_t *coefficients = NULL;
+        if (self->coefficients) {
+            coefficients = self->coefficients + (self->position >> self->phase_shift) * taps;
+        }
+        for (uint8_t c = 0; c < channel_count; c++) {
+            const int16_t *window = self->history + c * 2 * taps + self->head;
+            int32_t value;
+            if (coefficients) {
+                int32_t sum = 0;
+                for (uint8_t k = 0; k < taps; k++) {
+                    sum += window[k] * coefficients[k];
+                }
+                value = MIN(MAX(sum >> 15, INT16_MIN), INT16_MAX);
+            } else {
+                int32_t fraction = self->position >> 17;
+                value = window[0] + (((window[1] - window[0]) * fraction) >> 15);
+            }
+            store(self, index++, value);
+        }
+        uint32_t position = self->position + self->step_fraction;
+        self->pending = self->step + (position < self->position);
+        self->position = position;
+    }
+    // Pad a short final block with silence out to a whole word.
+    uint32_t bytes_per_sample = self->bits_per_sample / 8;
+    while (index * bytes_per_sample % sizeof(uint32_t) != 0) {
+        store(self, index++, 0);
+    }
+    return index * bytes_per_sample / sizeof(uint32_t);
+}
@@ -0,0 +1,51 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// Output frames produced per call to audiomixer_resampler_fill().
+#define AUDIOMIXER_RESAMPLE_FRAMES (64)
+
+#define AUDIOMIXER_RESAMPLE_LINEAR (0)
+#define AUDIOMIXER_RESAMPLE_MAX_QUALITY (2)
+
+// Converts a sample to the mixer's rate. The source has the same sample
+// format as the mixer; only the rate differs. Quality 0 interpolates
+// linearly between neighbouring frames, higher qualities use a windowed
+// sinc filter with more taps and phases.
+typedef struct {
+    int16_t *coefficients; // phases x taps, Q15; NULL for linear interpolation
+    int16_t *history; // channel_count x 2 * taps, each window stored twice
+    uint32_t *buffer; // resampled frames in the mixer's format
+    uint8_t *input; // remaining source data
+    uint32_t input_length; // in bytes
+    uint32_t sample_rate; // of the source
+    uint32_t position; // between input frames, as a 32 bit fraction
+    uint32_t step_fraction;
+    uint32_t step; // whole input frames per output frame
+    uint32_t pending; // input frames to read before the next output frame
+    uint8_t flush; // silent frames still to read after the source ends
+    uint8_t taps;
+    uint8_t phase_shift;
+    uint8_t head;
+    uint8_t quality;
+    uint8_t channel_count;
+    uint8_t bits_per_sample;
+    bool samples_signed;
+    bool more_data;
+} audiomixer_resampler_t;
+
+// Allocates and may raise, so call it from the VM only. The filter is kept
+// when the next sample has the same rate.
+void audiomixer_resampler_start(audiomixer_resampler_t *self, uint8_t quality,
+    uint32_t sample_rate, uint32_t output_rate, uint8_t channel_count,
+    uint8_t bits_per_sample, bool samples_signed);
+
+// Resamples the next block of the sample into self->buffer and returns its
+// length in words, or 0 once the sample has finished.
+uint32_t audiomixer_resampler_fill(audiomixer_resampler_t *self, mp_obj_t sample, bool loop);
@@ -35,6 +35,18 @@ static void check_matching_details(displayio_bitmap_t *b1, displayio_bitmap_t *b
     }
 }
 
+// Returns the row of mask that pixels of row y are tested against, or NULL if none are masked.
+static const uint32_t *mask_row(displayio_bitmap_t *mask, int y) {
+    if (mask == NULL || y >= mask->height) {
+        return NULL;
+    }
+    return displayio_bitmap_get_row(mask, y);
+}
+
+static bool is_masked(displayio_bitmap_t *mask, const uint32_t *row, int x) {
+    return row != NULL && x < mask->width && displayio_bitmap_get_row_value(mask, row, x);
+}
+
 size_t scratchpad_size = 0;
 static void *scratchpad = NULL;
 
@@ -115,8 +127,9 @@ void shared_module_bitmapfilter_morph(
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
                 uint16_t *buf_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(&buf, (y % brows));
 
+                const uint32_t *mask_row_ptr = mask_row(mask, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    if (is_masked(mask, mask_row_ptr, x)) {
                         IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
                         continue; // Short circuit.
 
@@ -223,8 +236,9 @@ void shared_module_bitmapfilter_mix(
         case 16: {
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+                const uint32_t *mask_row_ptr = mask_row(mask, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    if (is_masked(mask, mask_row_ptr, x)) {
                         continue; // Short circuit.
                     }
                     int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
@@ -277,8 +291,9 @@ void shared_module_bitmapfilter_solarize(
         case 16: {
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+                const uint32_t *mask_row_ptr = mask_row(mask, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    if (is_masked(mask, mask_row_ptr, x)) {
                         continue; // Short circuit.
                     }
                     int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
@@ -308,8 +323,9 @@ void shared_module_bitmapfilter_lookup(
         case 16: {
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+                const uint32_t *mask_row_ptr = mask_row(mask, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    if (is_masked(mask, mask_row_ptr, x)) {
                         continue; // Short circuit.
                     }
                     int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
@@ -350,8 +366,9 @@ void shared_module_bitmapfilter_false_color(
         case 16: {
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+                const uint32_t *mask_row_ptr = mask_row(mask, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    if (is_masked(mask, mask_row_ptr, x)) {
                         continue; // Short circuit.
                     }
                     int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
@@ -397,9 +414,10 @@ void shared_module_bitmapfilter_blend(
                 uint16_t *dest_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
                 uint16_t *src1_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(src1, y);
                 uint16_t *src2_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(src2, y);
+                const uint32_t *mask_row_ptr = mask_row(mask, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
                     int pixel1 = IMAGE_GET_RGB565_PIXEL_FAST(src1_ptr, x);
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    if (is_masked(mask, mask_row_ptr, x)) {
                         IMAGE_PUT_RGB565_PIXEL_FAST(dest_ptr, x, pixel1);
                         continue; // Short circuit.
                     }
@@ -23,6 +23,9 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Pixels moved at a time by the row based loops, sized to keep their buffers small on the stack.
+#define BITMAPTOOLS_ROW_CHUNK (32)
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -221,11 +224,8 @@ void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     // update the dirty rectangle
     displayio_bitmap_set_dirty_area(destination, &area);
 
-    int16_t x, y;
-    for (x = area.x1; x < area.x2; x++) {
-        for (y = area.y1; y < area.y2; y++) {
-            displayio_bitmap_write_pixel(destination, x, y, value);
-        }
+    for (int16_t y = area.y1; y < area.y2 && area.x1 < area.x2; y++) {
+        displayio_bitmap_fill_row(destination, area.x1, y, area.x2 - area.x1, value);
     }
 }
 
@@ -398,8 +398,8 @@ static void draw_line(displayio_bitmap_t *destination,
         }
         x0 = MAX(0, x0); // only draw inside bitmap
         x1 = MIN(x1, destination->width - 1);
-        for (x = x0; x < (x1 + 1); x++) { // write a horizontal line
-            displayio_bitmap_write_pixel(destination, x, y0, value);
+        if (x1 >= x0) {
+            displayio_bitmap_fill_row(destination, x0, y0, x1 - x0 + 1, value);
         }
     } else {
         bool steep;
@@ -530,28 +530,37 @@ void common_hal_bitmaptools_draw_polygon(displayio_bitmap_t *destination, void *
 
 void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int element_size, int x1, int y1, int x2, int y2, bool skip_specified, uint32_t skip_value) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
+    uint32_t values[BITMAPTOOLS_ROW_CHUNK];
 
     for (int y = y1; y < y2; y++) {
-        for (int x = x1; x < x2; x++) {
-            uint32_t value;
-            switch (element_size) {
-                default:
-                case 1:
-                    value = *(uint8_t *)data;
-                    data = (void *)((uint8_t *)data + 1);
-                    break;
-                case 2:
-                    value = *(uint16_t *)data;
-                    data = (void *)((uint16_t *)data + 1);
-                    break;
-                case 4:
-                    value = *(uint32_t *)data;
-                    data = (void *)((uint32_t *)data + 1);
-                    break;
+        for (int x = x1; x < x2; x += BITMAPTOOLS_ROW_CHUNK) {
+            uint16_t count = MIN(x2 - x, BITMAPTOOLS_ROW_CHUNK);
+            if (skip_specified) {
+                // Skipped pixels are written back unchanged.
+                displayio_bitmap_read_row(self, x, y, count, values);
             }
-            if (!skip_specified || value != skip_value) {
-                displayio_bitmap_write_pixel(self, x, y, value & mask);
+            for (uint16_t i = 0; i < count; i++) {
+                uint32_t value;
+                switch (element_size) {
+                    default:
+                    case 1:
+                        value = *(uint8_t *)data;
+                        data = (void *)((uint8_t *)data + 1);
+                        break;
+                    case 2:
+                        value = *(uint16_t *)data;
+                        data = (void *)((uint16_t *)data + 1);
+                        break;
+                    case 4:
+                        value = *(uint32_t *)data;
+                        data = (void *)((uint32_t *)data + 1);
+                        break;
+                }
+                if (!skip_specified || value != skip_value) {
+                    values[i] = value & mask;
+                }
             }
+            displayio_bitmap_write_row(self, x, y, count, values);
         }
     }
     displayio_area_t area = { x1, y1, x2, y2, NULL };
@@ -603,6 +612,7 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
             }
         }
 
+        uint32_t values[BITMAPTOOLS_ROW_CHUNK];
         for (int x = 0; x < self->width; x++) {
             int value = 0;
             switch (bits_per_pixel) {
@@ -643,7 +653,11 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
                     value = rowdata32[x];
                     break;
             }
-            displayio_bitmap_write_pixel(self, x, y_draw, value & mask);
+            values[x % BITMAPTOOLS_ROW_CHUNK] = value & mask;
+            if (x % BITMAPTOOLS_ROW_CHUNK == BITMAPTOOLS_ROW_CHUNK - 1 || x == self->width - 1) {
+                int start = x - x % BITMAPTOOLS_ROW_CHUNK;
+                displayio_bitmap_write_row(self, start, y_draw, x - start + 1, values);
+            }
         }
     }
 }
@@ -731,23 +745,14 @@ static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
 }
 
 static void write_pixels(displayio_bitmap_t *bitmap, int y, bool *data) {
-    if (bitmap->bits_per_value == 1) {
-        uint32_t *pixel_data = (uint32_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            uint32_t p = 0;
-            for (int j = 0; j < 32; j++) {
-                p = (p << 1);
-                if (*data++) {
-                    p |= 1;
-                }
-            }
-            *pixel_data++ = p;
-        }
-    } else {
-        uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            *pixel_data++ = *data++ ? 65535 : 0;
+    uint32_t on = bitmap->bits_per_value == 1 ? 1 : 65535;
+    uint32_t values[BITMAPTOOLS_ROW_CHUNK];
+    for (int x = 0; x < bitmap->width; x += BITMAPTOOLS_ROW_CHUNK) {
+        uint16_t count = MIN(bitmap->width - x, BITMAPTOOLS_ROW_CHUNK);
+        for (uint16_t i = 0; i < count; i++) {
+            values[i] = *data++ ? on : 0;
         }
+        displayio_bitmap_write_row(bitmap, x, y, count, values);
     }
 }
 
@@ -1070,34 +1075,35 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         y_reverse = true;
     }
 
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
+    // Copy a row at a time in chunks, working against the direction of travel so that a bitmap
+    // blitted onto itself has each pixel read before it is overwritten.
+    uint32_t values[BITMAPTOOLS_ROW_CHUNK];
+    uint32_t dest_values[BITMAPTOOLS_ROW_CHUNK];
+    int16_t width = x2 - x1;
+    bool skip = !skip_source_index_none || !skip_dest_index_none;
+    for (int16_t j = 0; j < (y2 - y1); j++) {
+
+        const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
+        const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
+
+        if ((yd_index < 0) || (yd_index >= destination->height)) {
+            continue;
+        }
+        for (int16_t i = 0; i < width; i += BITMAPTOOLS_ROW_CHUNK) {
+            uint16_t count = MIN(width - i, BITMAPTOOLS_ROW_CHUNK);
+            int16_t offset = x_reverse ? width - i - count : i;
+            displayio_bitmap_read_row(source, x1 + offset, ys_index, count, values);
+            if (skip) {
+                // Skipped pixels are written back unchanged.
+                displayio_bitmap_read_row(destination, x + offset, yd_index, count, dest_values);
+                for (uint16_t k = 0; k < count; k++) {
+                    if ((!skip_source_index_none && values[k] == skip_source_index) ||
+                        (!skip_dest_index_none && dest_values[k] == skip_dest_index)) {
+                        values[k] = dest_values[k];
                     }
                 }
             }
+            displayio_bitmap_write_row(destination, x + offset, yd_index, count, values);
         }
     }
 }
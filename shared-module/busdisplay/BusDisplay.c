@@ -6,6 +6,7 @@
 
 #include "shared-bindings/busdisplay/BusDisplay.h"
 
+#include "py/mphal.h"
 #include "py/runtime.h"
 #if CIRCUITPY_FOURWIRE
 #include "shared-bindings/fourwire/FourWire.h"
@@ -19,6 +20,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/RefreshStats.h"
 #include "shared-module/displayio/display_core.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
@@ -59,6 +61,7 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
     self->write_ram_command = write_ram_command;
     self->brightness_command = brightness_command;
     self->first_manual_refresh = !auto_refresh;
+    self->refresh_stats = (busdisplay_refresh_stats_t) {0};
     self->backlight_on_high = backlight_on_high;
 
     self->native_frames_per_second = native_frames_per_second;
@@ -189,6 +192,10 @@ mp_obj_t common_hal_busdisplay_busdisplay_get_bus(busdisplay_busdisplay_obj_t *s
     return self->bus.bus;
 }
 
+const busdisplay_refresh_stats_t *common_hal_busdisplay_busdisplay_get_refresh_stats(busdisplay_busdisplay_obj_t *self) {
+    return &self->refresh_stats;
+}
+
 mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_obj_t *self) {
     if (self->core.current_group == NULL) {
         return mp_const_none;
@@ -206,11 +213,17 @@ static const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *s
     return NULL;
 }
 
+// Pixels may still be going out when this returns. Call _finish_send before changing them.
 static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uint32_t length) {
     if (!self->bus.data_as_commands) {
         self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
     }
-    self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
+    displayio_display_bus_send_nonblocking(&self->bus, pixels, length);
+}
+
+static void _finish_send(busdisplay_busdisplay_obj_t *self) {
+    displayio_display_bus_wait_for_send(&self->bus);
+    displayio_display_bus_end_transaction(&self->bus);
 }
 
 static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
@@ -254,12 +267,15 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
     }
 
+    // With a bus that sends in the background, fill one buffer while the other is sent.
+    uint8_t buffer_count = displayio_display_bus_can_send_nonblocking(&self->bus) ? 2 : 1;
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    uint32_t buffers[buffer_count * buffer_size];
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
     uint16_t remaining_rows = displayio_area_height(&clipped);
+    bool sending = false;
 
     for (uint16_t j = 0; j < subrectangles; j++) {
         displayio_area_t subrectangle = {
@@ -273,8 +289,6 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
         remaining_rows -= rows_per_buffer;
 
-        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
-
         uint16_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) * (self->core.colorspace.depth / 8);
@@ -282,19 +296,36 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
+        uint32_t *buffer = buffers + (j % buffer_count) * buffer_size;
         memset(mask, 0, mask_length * sizeof(mask[0]));
         memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
+        uint32_t start_us = mp_hal_ticks_us();
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        uint32_t filled_us = mp_hal_ticks_us();
+        self->refresh_stats.fill_us += filled_us - start_us;
+
+        if (sending) {
+            _finish_send(self);
+            sending = false;
+        }
 
         // Can't acquire display bus; skip the rest of the data.
         if (!displayio_display_bus_is_free(&self->bus)) {
             return false;
         }
 
+        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+
         displayio_display_bus_begin_transaction(&self->bus);
         _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
-        displayio_display_bus_end_transaction(&self->bus);
+        sending = true;
+        if (buffer_count == 1) {
+            _finish_send(self);
+            sending = false;
+        }
+        self->refresh_stats.bus_us += mp_hal_ticks_us() - filled_us;
+        displayio_refreshstats_record_transfer(filled_us, displayio_area_size(&subrectangle));
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
@@ -302,6 +333,12 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         usb_background();
         #endif
     }
+    if (sending) {
+        uint32_t start_us = mp_hal_ticks_us();
+        _finish_send(self);
+        self->refresh_stats.bus_us += mp_hal_ticks_us() - start_us;
+        displayio_refreshstats_record_transfer(start_us, 0);
+    }
     return true;
 }
 
@@ -310,12 +347,22 @@ static void _refresh_display(busdisplay_busdisplay_obj_t *self) {
         // A refresh on this bus is already in progress.  Try next display.
         return;
     }
+    uint32_t start_us = mp_hal_ticks_us();
     displayio_display_core_start_refresh(&self->core);
     const displayio_area_t *current_area = _get_refresh_areas(self);
+    // Keep the stats of the last frame that actually changed something.
+    bool changed = current_area != NULL;
+    if (changed) {
+        self->refresh_stats = (busdisplay_refresh_stats_t) {0};
+        displayio_refreshstats_record_frame(current_area);
+    }
     while (current_area != NULL) {
         _refresh_area(self, current_area);
         current_area = current_area->next;
     }
+    if (changed) {
+        self->refresh_stats.frame_us = mp_hal_ticks_us() - start_us;
+    }
     displayio_display_core_finish_refresh(&self->core);
 }
 
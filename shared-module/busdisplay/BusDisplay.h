@@ -16,6 +16,15 @@
 #include "shared-module/displayio/bus_core.h"
 #include "shared-module/displayio/display_core.h"
 
+// Times of the last refresh that sent anything, in microseconds.
+typedef struct {
+    uint32_t frame_us;
+    // Compositing pixels into the strip buffers.
+    uint32_t fill_us;
+    // Sending to the bus or waiting for an earlier send to finish.
+    uint32_t bus_us;
+} busdisplay_refresh_stats_t;
+
 typedef struct {
     mp_obj_base_t base;
     displayio_display_core_t core;
@@ -27,6 +36,7 @@ typedef struct {
         #endif
     };
     uint64_t last_refresh_call;
+    busdisplay_refresh_stats_t refresh_stats;
     mp_float_t current_brightness;
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
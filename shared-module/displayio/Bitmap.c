@@ -56,10 +56,11 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->x_mask = (1u << self->x_shift) - 1u; // Used as a modulus on the x value
     self->bitmask = (1u << bits_per_value) - 1u;
 
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = width;
-    self->dirty_area.y1 = 0;
-    self->dirty_area.y2 = height;
+    self->dirty_areas[0].x1 = 0;
+    self->dirty_areas[0].x2 = width;
+    self->dirty_areas[0].y1 = 0;
+    self->dirty_areas[0].y2 = height;
+    self->dirty_area_count = 1;
 }
 
 void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
@@ -89,24 +90,7 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     if (x >= self->width || x < 0 || y >= self->height || y < 0) {
         return 0;
     }
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
-    uint8_t bytes_per_value = self->bits_per_value / 8;
-    uint8_t values_per_byte = 8 / self->bits_per_value;
-    if (bytes_per_value < 1) {
-        uint8_t bits = ((uint8_t *)row)[x >> self->x_shift];
-        uint8_t bit_position = (values_per_byte - (x & self->x_mask) - 1) * self->bits_per_value;
-        return (bits >> bit_position) & self->bitmask;
-    } else {
-        if (bytes_per_value == 1) {
-            return ((uint8_t *)row)[x];
-        } else if (bytes_per_value == 2) {
-            return ((uint16_t *)row)[x];
-        } else if (bytes_per_value == 4) {
-            return ((uint32_t *)row)[x];
-        }
-    }
-    return 0;
+    return displayio_bitmap_get_row_value(self, displayio_bitmap_get_row(self, y), x);
 }
 
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *dirty_area) {
@@ -116,9 +100,14 @@ void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_a
 
     displayio_area_t area = *dirty_area;
     displayio_area_canon(&area);
-    displayio_area_union(&area, &self->dirty_area, &area);
     displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
-    displayio_area_compute_overlap(&area, &bitmap_area, &self->dirty_area);
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    // Keep separate areas for changes far apart so that only the changed pixels are sent to the
+    // display.
+    self->dirty_area_count = displayio_area_list_add(self->dirty_areas, self->dirty_area_count,
+        CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT, &area);
 }
 
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -134,23 +123,172 @@ void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y
     }
 
     // Update one pixel of data
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
-    uint8_t bytes_per_value = self->bits_per_value / 8;
-    uint8_t values_per_byte = 8 / self->bits_per_value;
-    if (bytes_per_value < 1) {
-        uint8_t bits = ((uint8_t *)row)[x >> self->x_shift];
-        uint8_t bit_position = (values_per_byte - (x & self->x_mask) - 1) * self->bits_per_value;
-        bits &= ~(self->bitmask << bit_position);
-        bits |= (value & self->bitmask) << bit_position;
-        ((uint8_t *)row)[x >> self->x_shift] = bits;
-    } else {
-        if (bytes_per_value == 1) {
+    uint32_t *row = displayio_bitmap_get_row(self, y);
+    switch (self->bits_per_value) {
+        case 8:
             ((uint8_t *)row)[x] = value;
-        } else if (bytes_per_value == 2) {
+            break;
+        case 16:
             ((uint16_t *)row)[x] = value;
-        } else if (bytes_per_value == 4) {
-            ((uint32_t *)row)[x] = value;
+            break;
+        case 32:
+            row[x] = value;
+            break;
+        default: {
+            uint8_t *bits = &((uint8_t *)row)[x >> self->x_shift];
+            uint8_t bit_position = (self->x_mask - (x & self->x_mask)) * self->bits_per_value;
+            *bits = (*bits & ~(self->bitmask << bit_position)) | ((value & self->bitmask) << bit_position);
+            break;
+        }
+    }
+}
+
+// Clips a run of count pixels of row y starting at *x to the bitmap. Returns the number of pixels
+// left and sets *skip to how many were cut from the start.
+static uint16_t _clip_row(displayio_bitmap_t *self, int16_t *x, int16_t y, uint16_t count, uint16_t *skip) {
+    *skip = 0;
+    if (y < 0 || y >= self->height || *x >= self->width || *x + count <= 0) {
+        return 0;
+    }
+    if (*x < 0) {
+        *skip = -*x;
+        count -= *skip;
+        *x = 0;
+    }
+    return MIN(count, self->width - *x);
+}
+
+void displayio_bitmap_read_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values) {
+    uint16_t skip;
+    uint16_t inside = _clip_row(self, &x, y, count, &skip);
+    memset(values, 0, skip * sizeof(uint32_t));
+    memset(values + skip + inside, 0, (count - skip - inside) * sizeof(uint32_t));
+    if (inside == 0) {
+        return;
+    }
+    values += skip;
+    uint32_t *row = displayio_bitmap_get_row(self, y);
+    switch (self->bits_per_value) {
+        case 8:
+            for (uint16_t i = 0; i < inside; i++) {
+                values[i] = ((uint8_t *)row)[x + i];
+            }
+            break;
+        case 16:
+            for (uint16_t i = 0; i < inside; i++) {
+                values[i] = ((uint16_t *)row)[x + i];
+            }
+            break;
+        case 32:
+            memcpy(values, row + x, inside * sizeof(uint32_t));
+            break;
+        default: {
+            // Load each byte once and shift its values out of the top.
+            uint8_t bits_per_value = self->bits_per_value;
+            const uint8_t *bytes = &((uint8_t *)row)[x >> self->x_shift];
+            uint8_t bits = *bytes++ << ((x & self->x_mask) * bits_per_value);
+            uint8_t left = self->x_mask + 1 - (x & self->x_mask);
+            for (uint16_t i = 0; i < inside; i++) {
+                if (left == 0) {
+                    bits = *bytes++;
+                    left = self->x_mask + 1;
+                }
+                values[i] = bits >> (8 - bits_per_value);
+                bits <<= bits_per_value;
+                left--;
+            }
+            break;
+        }
+    }
+}
+
+void displayio_bitmap_write_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, const uint32_t *values) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    uint16_t skip;
+    count = _clip_row(self, &x, y, count, &skip);
+    values += skip;
+    uint32_t *row = displayio_bitmap_get_row(self, y);
+    switch (self->bits_per_value) {
+        case 8:
+            for (uint16_t i = 0; i < count; i++) {
+                ((uint8_t *)row)[x + i] = values[i];
+            }
+            break;
+        case 16:
+            for (uint16_t i = 0; i < count; i++) {
+                ((uint16_t *)row)[x + i] = values[i];
+            }
+            break;
+        case 32:
+            memcpy(row + x, values, count * sizeof(uint32_t));
+            break;
+        default: {
+            uint8_t bits_per_value = self->bits_per_value;
+            uint8_t values_per_byte = self->x_mask + 1;
+            uint16_t i = 0;
+            // Partial first byte.
+            for (; i < count && ((x + i) & self->x_mask) != 0; i++) {
+                displayio_bitmap_write_pixel(self, x + i, y, values[i]);
+            }
+            // Whole bytes.
+            uint8_t *bytes = &((uint8_t *)row)[(x + i) >> self->x_shift];
+            for (; i + values_per_byte <= count; i += values_per_byte) {
+                uint8_t bits = 0;
+                for (uint8_t j = 0; j < values_per_byte; j++) {
+                    bits = (bits << bits_per_value) | (values[i + j] & self->bitmask);
+                }
+                *bytes++ = bits;
+            }
+            // Partial last byte.
+            for (; i < count; i++) {
+                displayio_bitmap_write_pixel(self, x + i, y, values[i]);
+            }
+            break;
+        }
+    }
+}
+
+void displayio_bitmap_fill_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t value) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    uint16_t skip;
+    count = _clip_row(self, &x, y, count, &skip);
+    uint32_t *row = displayio_bitmap_get_row(self, y);
+    switch (self->bits_per_value) {
+        case 8:
+            memset((uint8_t *)row + x, value, count);
+            break;
+        case 16:
+            for (uint16_t i = 0; i < count; i++) {
+                ((uint16_t *)row)[x + i] = value;
+            }
+            break;
+        case 32:
+            for (uint16_t i = 0; i < count; i++) {
+                row[x + i] = value;
+            }
+            break;
+        default: {
+            uint16_t i = 0;
+            for (; i < count && ((x + i) & self->x_mask) != 0; i++) {
+                displayio_bitmap_write_pixel(self, x + i, y, value);
+            }
+            uint16_t whole_bytes = (count - i) >> self->x_shift;
+            if (whole_bytes > 0) {
+                uint8_t bits = 0;
+                for (uint8_t j = 0; j <= self->x_mask; j++) {
+                    bits = (bits << self->bits_per_value) | (value & self->bitmask);
+                }
+                memset(&((uint8_t *)row)[(x + i) >> self->x_shift], bits, whole_bytes);
+                i += whole_bytes << self->x_shift;
+            }
+            for (; i < count; i++) {
+                displayio_bitmap_write_pixel(self, x + i, y, value);
+            }
+            break;
         }
     }
 }
@@ -169,19 +307,21 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
 }
 
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail) {
-    if (self->dirty_area.x1 == self->dirty_area.x2 || self->read_only) {
+    if (self->read_only) {
         return tail;
     }
-    self->dirty_area.next = tail;
-    return &self->dirty_area;
+    for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+        self->dirty_areas[i].next = tail;
+        tail = &self->dirty_areas[i];
+    }
+    return tail;
 }
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
     if (self->read_only) {
         return;
     }
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = 0;
+    self->dirty_area_count = 0;
 }
 
 void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value) {
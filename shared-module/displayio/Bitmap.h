@@ -21,7 +21,8 @@ typedef struct {
     uint8_t bits_per_value;
     uint8_t x_shift;
     size_t x_mask;
-    displayio_area_t dirty_area;
+    displayio_area_t dirty_areas[CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT];
+    uint8_t dirty_area_count;
     uint16_t bitmask;
     bool read_only;
     bool data_alloc; // did bitmap allocate data or someone else
@@ -31,3 +32,35 @@ void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail);
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value);
+
+// Row access for loops over many pixels. Value x of a row starts x * bits_per_value bits into it.
+// Values of fewer than 8 bits are packed most significant first within each byte. Rows are stride
+// uint32_t's apart.
+static inline uint32_t *displayio_bitmap_get_row(const displayio_bitmap_t *self, int16_t y) {
+    return self->data + y * self->stride;
+}
+
+// Reads value x of a row from displayio_bitmap_get_row. x must be within the bitmap.
+static inline uint32_t displayio_bitmap_get_row_value(const displayio_bitmap_t *self, const uint32_t *row, int16_t x) {
+    switch (self->bits_per_value) {
+        case 8:
+            return ((const uint8_t *)row)[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 32:
+            return row[x];
+        default: {
+            uint8_t bits = ((const uint8_t *)row)[x >> self->x_shift];
+            uint8_t bit_position = (self->x_mask - (x & self->x_mask)) * self->bits_per_value;
+            return (bits >> bit_position) & self->bitmask;
+        }
+    }
+}
+
+// Reads count values of row y starting at x. Values outside the bitmap read as 0.
+void displayio_bitmap_read_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values);
+// Writes count values to row y starting at x, skipping any outside the bitmap. Like
+// displayio_bitmap_write_pixel, the dirty area must be updated separately.
+void displayio_bitmap_write_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, const uint32_t *values);
+// Writes value to count pixels of row y starting at x, skipping any outside the bitmap.
+void displayio_bitmap_fill_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t value);
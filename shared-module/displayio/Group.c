@@ -9,6 +9,7 @@
 #include "py/runtime.h"
 #include "py/objlist.h"
 #include "shared-bindings/displayio/TileGrid.h"
+#include "shared-module/displayio/RefreshStats.h"
 
 #if CIRCUITPY_VECTORIO
 #include "shared-bindings/vectorio/VectorShape.h"
@@ -366,17 +367,46 @@ void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members,
     self->readonly = false;
 }
 
-bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+// Grows occluded by a newly drawn opaque area when the two together still form a rectangle,
+// otherwise keeps the larger of the two.
+static void _add_occluded(displayio_area_t *occluded, const displayio_area_t *opaque) {
+    displayio_area_t u;
+    displayio_area_union(occluded, opaque, &u);
+    displayio_area_t overlap;
+    uint32_t overlap_size = 0;
+    if (displayio_area_compute_overlap(occluded, opaque, &overlap)) {
+        overlap_size = displayio_area_size(&overlap);
+    }
+    if (displayio_area_size(&u) == displayio_area_size(occluded) + displayio_area_size(opaque) - overlap_size) {
+        displayio_area_copy(&u, occluded);
+    } else if (displayio_area_size(opaque) > displayio_area_size(occluded)) {
+        displayio_area_copy(opaque, occluded);
+    }
+}
+
+// occluded is a rectangle of area that opaque layers above have already drawn every pixel of.
+// Layers entirely within it are skipped, and layers that are opaque add to it.
+static bool _fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer, displayio_area_t *occluded) {
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     if (self->hidden == false) {
         for (int32_t i = self->members->len - 1; i >= 0; i--) {
             mp_obj_t layer;
+            displayio_area_t bounds;
+            displayio_area_t overlap;
             #if CIRCUITPY_VECTORIO
             const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
             if (draw_protocol != NULL) {
                 layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-                if (draw_protocol->draw_protocol_impl->draw_fill_area(layer, colorspace, area, mask, buffer)) {
+                if (!draw_protocol->draw_protocol_impl->draw_get_bounds(layer, &bounds) ||
+                    !displayio_area_compute_overlap(area, &bounds, &overlap) ||
+                    displayio_area_contains(occluded, &overlap)) {
+                    continue;
+                }
+                uint32_t start = displayio_refreshstats_start();
+                bool full_coverage = draw_protocol->draw_protocol_impl->draw_fill_area(layer, colorspace, area, mask, buffer);
+                displayio_refreshstats_record_layer(self->members->items[i], start);
+                if (full_coverage) {
                     return true;
                 }
                 continue;
@@ -385,15 +415,30 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
             layer = mp_obj_cast_to_native_base(
                 self->members->items[i], &displayio_tilegrid_type);
             if (layer != MP_OBJ_NULL) {
-                if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer)) {
+                displayio_tilegrid_t *tilegrid = layer;
+                if (!displayio_area_compute_overlap(area, &tilegrid->current_area, &overlap) ||
+                    displayio_area_contains(occluded, &overlap)) {
+                    continue;
+                }
+                uint32_t start = displayio_refreshstats_start();
+                bool full_coverage = displayio_tilegrid_fill_area(tilegrid, colorspace, area, mask, buffer);
+                displayio_refreshstats_record_layer(self->members->items[i], start);
+                if (full_coverage) {
                     return true;
                 }
+                if (displayio_tilegrid_get_opaque_area(tilegrid, colorspace, &bounds) &&
+                    displayio_area_compute_overlap(area, &bounds, &overlap)) {
+                    _add_occluded(occluded, &overlap);
+                    if (displayio_area_equal(occluded, area)) {
+                        return true;
+                    }
+                }
                 continue;
             }
             layer = mp_obj_cast_to_native_base(
                 self->members->items[i], &displayio_group_type);
             if (layer != MP_OBJ_NULL) {
-                if (displayio_group_fill_area(layer, colorspace, area, mask, buffer)) {
+                if (_fill_area(layer, colorspace, area, mask, buffer, occluded)) {
                     return true;
                 }
                 continue;
@@ -403,6 +448,11 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
     return false;
 }
 
+bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    displayio_area_t occluded = {area->x1, area->y1, area->x1, area->y1, NULL};
+    return _fill_area(self, colorspace, area, mask, buffer, &occluded);
+}
+
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->item_removed = false;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
@@ -464,3 +514,84 @@ displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, dis
 
     return tail;
 }
+
+// Returns true if a layer drawn after `below` draws, or drew last frame, within area. Shifting the
+// pixels of area would move those too. found is set once the walk passes `below`.
+static bool _overlaps_above(displayio_group_t *self, mp_obj_t below, const displayio_area_t *area, bool *found) {
+    displayio_area_t overlap;
+    if (self->item_removed && displayio_area_compute_overlap(area, &self->dirty_area, &overlap)) {
+        return true;
+    }
+    for (size_t i = 0; i < self->members->len; i++) {
+        mp_obj_t layer;
+        displayio_area_t bounds;
+        if (self->members->items[i] == below) {
+            *found = true;
+            continue;
+        }
+        #if CIRCUITPY_VECTORIO
+        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
+        if (draw_protocol != NULL) {
+            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
+            if (*found && draw_protocol->draw_protocol_impl->draw_get_dirty_area(layer, &bounds) &&
+                displayio_area_compute_overlap(area, &bounds, &overlap)) {
+                return true;
+            }
+            continue;
+        }
+        #endif
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_tilegrid_t *tilegrid = layer;
+            if (*found &&
+                ((!tilegrid->hidden && !tilegrid->hidden_by_parent &&
+                  displayio_area_compute_overlap(area, &tilegrid->current_area, &overlap)) ||
+                 (displayio_tilegrid_get_previous_area(tilegrid, &bounds) &&
+                  displayio_area_compute_overlap(area, &bounds, &overlap)))) {
+                return true;
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            if (_overlaps_above(layer, below, area, found)) {
+                return true;
+            }
+            continue;
+        }
+    }
+    return false;
+}
+
+static bool _scroll(displayio_group_t *self, displayio_group_t *root, const _displayio_colorspace_t *colorspace, displayio_scroll_fun scroll, void *display) {
+    bool scrolled = false;
+    for (size_t i = 0; i < self->members->len; i++) {
+        mp_obj_t layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_area_t area;
+            int16_t dx, dy;
+            bool found = false;
+            if (displayio_tilegrid_get_scroll(layer, colorspace, &area, &dx, &dy) &&
+                !_overlaps_above(root, self->members->items[i], &area, &found) &&
+                scroll(display, &area, dx, dy)) {
+                displayio_tilegrid_finish_scroll(layer);
+                scrolled = true;
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            scrolled = _scroll(layer, root, colorspace, scroll, display) || scrolled;
+            continue;
+        }
+    }
+    return scrolled;
+}
+
+bool displayio_group_scroll(displayio_group_t *self, const _displayio_colorspace_t *colorspace, displayio_scroll_fun scroll, void *display) {
+    return _scroll(self, self, colorspace, scroll, display);
+}
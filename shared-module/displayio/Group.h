@@ -30,6 +30,10 @@ typedef struct {
     uint8_t padding : 3;
 } displayio_group_t;
 
+// Shifts the pixels of area on the display by dx, dy. Returns false if the display can't, in which
+// case the area is redrawn instead.
+typedef bool (*displayio_scroll_fun)(void *display, const displayio_area_t *area, int16_t dx, int16_t dy);
+
 void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members, uint32_t scale, mp_int_t x, mp_int_t y);
 void displayio_group_set_hidden_by_parent(displayio_group_t *self, bool hidden);
 bool displayio_group_get_previous_area(displayio_group_t *group, displayio_area_t *area);
@@ -37,3 +41,6 @@ bool displayio_group_fill_area(displayio_group_t *group, const _displayio_colors
 void displayio_group_update_transform(displayio_group_t *group, const displayio_buffer_transform_t *parent_transform);
 void displayio_group_finish_refresh(displayio_group_t *self);
 displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_t *tail);
+// Offers scroll every TileGrid area that only moved within itself since the last refresh. Call it
+// before displayio_group_get_refresh_areas. Returns true if any pixels were shifted.
+bool displayio_group_scroll(displayio_group_t *self, const _displayio_colorspace_t *colorspace, displayio_scroll_fun scroll, void *display);
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "shared-bindings/displayio/OnDiskBitmap.h"
+#include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-module/displayio/ColorConverter.h"
@@ -95,7 +96,7 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
             for (uint16_t i = 0; i < number_of_colors; i++) {
                 common_hal_displayio_palette_set_color(palette, i, palette_data[i]);
             }
-            m_free(palette_data);
+            m_del(uint32_t, palette_data, number_of_colors);
         } else {
             common_hal_displayio_palette_set_color(palette, 0, 0x0);
             common_hal_displayio_palette_set_color(palette, 1, 0xffffff);
@@ -126,6 +127,85 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    // Reading a whole strip of rows at once is much faster than seeking for every pixel, even
+    // with the filesystem's sector cache. Fall back to per-pixel reads if we're short on RAM.
+    uint16_t cache_rows = CIRCUITPY_ONDISKBITMAP_CACHE_SIZE / MAX(self->stride, 1);
+    self->cache_rows = MAX(1, MIN(cache_rows, self->height));
+    self->cache = m_malloc_maybe(self->cache_rows * self->stride);
+    self->cached_y = 0;
+    self->cached_rows = 0;
+}
+
+// Makes sure row y is in the cache and returns it, or NULL if it couldn't be read.
+static uint8_t *load_row(displayio_ondiskbitmap_t *self, int16_t y) {
+    if (y < self->cached_y || y >= self->cached_y + self->cached_rows) {
+        // Rows are stored bottom up. Read a strip going in the direction we appear to be moving
+        // so that the next rows we are asked for are included.
+        int16_t first_y = y;
+        if (self->cached_rows > 0 && y < self->cached_y) {
+            first_y = MAX(0, y - self->cache_rows + 1);
+        }
+        uint16_t rows = MIN(self->cache_rows, self->height - first_y);
+        uint32_t location = self->data_offset + (self->height - first_y - rows) * self->stride;
+        uint32_t size = rows * self->stride;
+
+        self->cached_rows = 0;
+        UINT bytes_read;
+        if (f_lseek(&self->file->fp, location) != FR_OK ||
+            f_read(&self->file->fp, self->cache, size, &bytes_read) != FR_OK) {
+            return NULL;
+        }
+        // A truncated file reads as zeros, as it does when reading a pixel at a time.
+        memset(self->cache + bytes_read, 0, size - bytes_read);
+        self->cached_y = first_y;
+        self->cached_rows = rows;
+    }
+    return self->cache + (self->cached_y + self->cached_rows - y - 1) * self->stride;
+}
+
+static uint32_t decode_pixel(displayio_ondiskbitmap_t *self, int16_t x, uint32_t pixel_data) {
+    uint32_t tmp = 0;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
+    if (bytes_per_pixel == 1) {
+        uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
+        uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
+        uint8_t mask = (1 << self->bits_per_pixel) - 1;
+
+        return (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
+    } else if (bytes_per_pixel == 2) {
+        if (self->g_bitmask == 0x07e0) { // 565
+            red = ((pixel_data & self->r_bitmask) >> 11);
+            green = ((pixel_data & self->g_bitmask) >> 5);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        } else { // 555
+            red = ((pixel_data & self->r_bitmask) >> 10);
+            green = ((pixel_data & self->g_bitmask) >> 4);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        }
+        tmp = (red << 19 | green << 10 | blue << 3);
+        return tmp;
+    } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
+        return pixel_data & 0x00FFFFFF;
+    } else {
+        return pixel_data;
+    }
+}
+
+// Returns the raw, little endian data for pixel x of a cached row.
+static uint32_t read_pixel_data(displayio_ondiskbitmap_t *self, const uint8_t *row, int16_t x) {
+    switch (self->bits_per_pixel) {
+        case 16:
+            return row[x * 2] | row[x * 2 + 1] << 8;
+        case 24:
+            return row[x * 3] | row[x * 3 + 1] << 8 | row[x * 3 + 2] << 16;
+        case 32:
+            return row[x * 4] | row[x * 4 + 1] << 8 | row[x * 4 + 2] << 16 | (uint32_t)row[x * 4 + 3] << 24;
+        default:
+            return row[x / (8 / self->bits_per_pixel)];
+    }
 }
 
 
@@ -135,6 +215,14 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
         return 0;
     }
 
+    if (self->cache != NULL) {
+        uint8_t *row = load_row(self, y);
+        if (row == NULL) {
+            return 0;
+        }
+        return decode_pixel(self, x, read_pixel_data(self, row, x));
+    }
+
     uint32_t location;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
@@ -143,40 +231,62 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
+    // Without a row cache we rely on the underlying FS caching sectors.
     f_lseek(&self->file->fp, location);
     UINT bytes_read;
     uint32_t pixel_data = 0;
     uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
     if (result == FR_OK) {
-        uint32_t tmp = 0;
-        uint8_t red;
-        uint8_t green;
-        uint8_t blue;
-        if (bytes_per_pixel == 1) {
-            uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
-            uint8_t mask = (1 << self->bits_per_pixel) - 1;
-
-            return (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
-        } else if (bytes_per_pixel == 2) {
-            if (self->g_bitmask == 0x07e0) { // 565
-                red = ((pixel_data & self->r_bitmask) >> 11);
-                green = ((pixel_data & self->g_bitmask) >> 5);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            } else { // 555
-                red = ((pixel_data & self->r_bitmask) >> 10);
-                green = ((pixel_data & self->g_bitmask) >> 4);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            }
-            tmp = (red << 19 | green << 10 | blue << 3);
-            return tmp;
-        } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
-            return pixel_data & 0x00FFFFFF;
+        return decode_pixel(self, x, pixel_data);
+    }
+    return 0;
+}
+
+void displayio_ondiskbitmap_fill_row(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values) {
+    uint8_t *row = NULL;
+    if (self->cache != NULL && y >= 0 && y < self->height) {
+        row = load_row(self, y);
+    }
+    if (row == NULL) {
+        for (uint16_t i = 0; i < count; i++) {
+            values[i] = common_hal_displayio_ondiskbitmap_get_pixel(self, x + i, y);
+        }
+        return;
+    }
+    for (uint16_t i = 0; i < count; i++, x++) {
+        if (x < 0 || x >= self->width) {
+            values[i] = 0;
         } else {
-            return pixel_data;
+            values[i] = decode_pixel(self, x, read_pixel_data(self, row, x));
         }
     }
-    return 0;
+}
+
+mp_obj_t common_hal_displayio_ondiskbitmap_load(displayio_ondiskbitmap_t *self, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t step) {
+    uint16_t width = (x2 - x1 + step - 1) / step;
+    uint16_t height = (y2 - y1 + step - 1) / step;
+    // Indexed images keep their palette indices. Everything else is loaded as RGB888 to match
+    // the ColorConverter used as our pixel_shader.
+    uint8_t bits_per_value = self->bits_per_pixel <= 8 ? self->bits_per_pixel : 32;
+
+    displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+    common_hal_displayio_bitmap_construct(bitmap, width, height, bits_per_value);
+
+    uint32_t values[32];
+    const int16_t chunk = MP_ARRAY_SIZE(values);
+    for (uint16_t j = 0; j < height; j++) {
+        int16_t y = y1 + j * step;
+        uint16_t i = 0;
+        for (int16_t x = x1; x < x2; x += chunk) {
+            uint16_t count = MIN(chunk, x2 - x);
+            displayio_ondiskbitmap_fill_row(self, x, y, count, values);
+            // Keep every step'th pixel, continuing the pattern across chunks.
+            for (uint16_t k = (i * step) - (x - x1); k < count; k += step, i++) {
+                displayio_bitmap_write_pixel(bitmap, i, j, values[k]);
+            }
+        }
+    }
+    return MP_OBJ_FROM_PTR(bitmap);
 }
 
 uint16_t common_hal_displayio_ondiskbitmap_get_height(displayio_ondiskbitmap_t *self) {
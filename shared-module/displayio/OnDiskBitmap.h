@@ -23,6 +23,12 @@ typedef struct {
     uint32_t g_bitmask;
     uint32_t b_bitmask;
     pyb_file_obj_t *file;
+    // Rows [cached_y, cached_y + cached_rows) as stored in the file, last row first. NULL if
+    // there wasn't room for a single row, in which case pixels are read one at a time.
+    uint8_t *cache;
+    uint16_t cache_rows;
+    int16_t cached_y;
+    uint16_t cached_rows;
     union {
         mp_obj_base_t *pixel_shader_base;
         struct displayio_palette *palette;
@@ -31,3 +37,6 @@ typedef struct {
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
+
+// Reads count pixels of row y starting at x into values. Pixels outside of the image read as 0.
+void displayio_ondiskbitmap_fill_row(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values);
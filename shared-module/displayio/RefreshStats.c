@@ -0,0 +1,139 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/displayio/RefreshStats.h"
+
+#include "py/mphal.h"
+#include "py/objtuple.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+
+void common_hal_displayio_refreshstats_construct(displayio_refreshstats_t *self, uint16_t max_layers) {
+    self->layers = m_new(displayio_refreshstats_layer_t, max_layers);
+    self->max_layers = max_layers;
+    common_hal_displayio_refreshstats_clear(self);
+}
+
+void common_hal_displayio_refreshstats_clear(displayio_refreshstats_t *self) {
+    self->frames = 0;
+    self->dirty_areas = 0;
+    self->composite_ticks = 0;
+    self->transfer_ticks = 0;
+    self->pixels_composited = 0;
+    self->pixels_sent = 0;
+    self->layer_count = 0;
+}
+
+void common_hal_displayio_refreshstats_resume(displayio_refreshstats_t *self) {
+    if (MP_STATE_VM(displayio_running_refreshstats) != MP_OBJ_NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    MP_STATE_VM(displayio_running_refreshstats) = MP_OBJ_FROM_PTR(self);
+}
+
+void common_hal_displayio_refreshstats_pause(displayio_refreshstats_t *self) {
+    if (MP_STATE_VM(displayio_running_refreshstats) == MP_OBJ_FROM_PTR(self)) {
+        MP_STATE_VM(displayio_running_refreshstats) = MP_OBJ_NULL;
+    }
+}
+
+uint32_t common_hal_displayio_refreshstats_get_frames(displayio_refreshstats_t *self) {
+    return self->frames;
+}
+
+uint32_t common_hal_displayio_refreshstats_get_dirty_areas(displayio_refreshstats_t *self) {
+    return self->dirty_areas;
+}
+
+uint32_t common_hal_displayio_refreshstats_get_composite_ticks(displayio_refreshstats_t *self) {
+    return self->composite_ticks;
+}
+
+uint32_t common_hal_displayio_refreshstats_get_transfer_ticks(displayio_refreshstats_t *self) {
+    return self->transfer_ticks;
+}
+
+uint32_t common_hal_displayio_refreshstats_get_pixels_composited(displayio_refreshstats_t *self) {
+    return self->pixels_composited;
+}
+
+uint32_t common_hal_displayio_refreshstats_get_pixels_sent(displayio_refreshstats_t *self) {
+    return self->pixels_sent;
+}
+
+mp_obj_t common_hal_displayio_refreshstats_get_layers(displayio_refreshstats_t *self) {
+    mp_obj_tuple_t *layers = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->layer_count, NULL));
+    for (uint16_t i = 0; i < self->layer_count; i++) {
+        mp_obj_t pair[2] = {
+            self->layers[i].layer,
+            mp_obj_new_int_from_uint(self->layers[i].ticks),
+        };
+        layers->items[i] = mp_obj_new_tuple(2, pair);
+    }
+    return MP_OBJ_FROM_PTR(layers);
+}
+
+uint32_t displayio_refreshstats_start(void) {
+    if (MP_STATE_VM(displayio_running_refreshstats) == MP_OBJ_NULL) {
+        return 0;
+    }
+    return mp_hal_ticks_us();
+}
+
+void displayio_refreshstats_record_frame(const displayio_area_t *areas) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(displayio_running_refreshstats));
+    if (self == NULL) {
+        return;
+    }
+    self->frames++;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        self->dirty_areas++;
+    }
+}
+
+void displayio_refreshstats_record_composite(uint32_t start, uint32_t pixels) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(displayio_running_refreshstats));
+    if (self == NULL) {
+        return;
+    }
+    self->composite_ticks += mp_hal_ticks_us() - start;
+    self->pixels_composited += pixels;
+}
+
+void displayio_refreshstats_record_transfer(uint32_t start, uint32_t pixels) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(displayio_running_refreshstats));
+    if (self == NULL) {
+        return;
+    }
+    self->transfer_ticks += mp_hal_ticks_us() - start;
+    self->pixels_sent += pixels;
+}
+
+void displayio_refreshstats_record_layer(mp_obj_t layer, uint32_t start) {
+    displayio_refreshstats_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(displayio_running_refreshstats));
+    if (self == NULL) {
+        return;
+    }
+    uint32_t ticks = mp_hal_ticks_us() - start;
+    for (uint16_t i = 0; i < self->layer_count; i++) {
+        if (self->layers[i].layer == layer) {
+            self->layers[i].ticks += ticks;
+            return;
+        }
+    }
+    // Layers past max_layers aren't tracked individually.
+    if (self->layer_count < self->max_layers) {
+        self->layers[self->layer_count].layer = layer;
+        self->layers[self->layer_count].ticks = ticks;
+        self->layer_count++;
+    }
+}
+
+void displayio_refreshstats_reset(void) {
+    MP_STATE_VM(displayio_running_refreshstats) = MP_OBJ_NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t displayio_running_refreshstats);
@@ -0,0 +1,44 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "shared-module/displayio/area.h"
+
+typedef struct {
+    mp_obj_t layer;
+    uint32_t ticks;
+} displayio_refreshstats_layer_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    displayio_refreshstats_layer_t *layers;
+    uint32_t frames;
+    uint32_t dirty_areas;
+    uint32_t composite_ticks;
+    uint32_t transfer_ticks;
+    uint32_t pixels_composited;
+    uint32_t pixels_sent;
+    uint16_t max_layers;
+    uint16_t layer_count;
+} displayio_refreshstats_t;
+
+// Hooks used by the displays and Group to record into the running RefreshStats, if any. Ticks are
+// from mp_hal_ticks_us. displayio_refreshstats_start returns the tick to pass to the other hooks
+// and is cheap when nothing is recording.
+uint32_t displayio_refreshstats_start(void);
+// Counts a frame and its dirty areas. areas is NULL for a frame that only scrolled.
+void displayio_refreshstats_record_frame(const displayio_area_t *areas);
+void displayio_refreshstats_record_composite(uint32_t start, uint32_t pixels);
+void displayio_refreshstats_record_transfer(uint32_t start, uint32_t pixels);
+void displayio_refreshstats_record_layer(mp_obj_t layer, uint32_t start);
+
+// Stops recording because the object is about to be freed with the heap.
+void displayio_refreshstats_reset(void);
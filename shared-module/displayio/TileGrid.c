@@ -50,6 +50,7 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
     self->hidden_by_parent = false;
     self->previous_area.x1 = 0xffff;
     self->previous_area.x2 = self->previous_area.x1;
+    self->dirty_area_count = 0;
     self->flip_x = false;
     self->flip_y = false;
     self->transpose_xy = false;
@@ -81,6 +82,38 @@ void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hi
     }
 }
 
+// True when every value the bitmap can hold is drawn as an opaque pixel.
+static bool _is_opaque(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace) {
+    uint8_t bits_per_value;
+    if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        bits_per_value = ((displayio_bitmap_t *)self->bitmap)->bits_per_value;
+    } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
+        bits_per_value = ((displayio_ondiskbitmap_t *)self->bitmap)->bits_per_pixel;
+    } else {
+        return false;
+    }
+    if (self->pixel_shader == mp_const_none) {
+        return true;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        uint32_t value_count = bits_per_value >= 32 ? UINT32_MAX : 1u << bits_per_value;
+        return displayio_palette_is_opaque(self->pixel_shader, value_count);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return displayio_colorconverter_is_opaque(self->pixel_shader, colorspace);
+    }
+    return false;
+}
+
+bool displayio_tilegrid_get_opaque_area(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace, displayio_area_t *area) {
+    if (self->hidden || self->hidden_by_parent || (!self->inline_tiles && self->tiles == NULL)) {
+        return false;
+    }
+    if (!_is_opaque(self, colorspace)) {
+        return false;
+    }
+    displayio_area_copy(&self->current_area, area);
+    return true;
+}
+
 bool displayio_tilegrid_get_previous_area(displayio_tilegrid_t *self, displayio_area_t *area) {
     if (self->previous_area.x1 == self->previous_area.x2) {
         return false;
@@ -254,29 +287,25 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
         return;
     }
     tiles[y * self->width_in_tiles + x] = tile_index;
-    displayio_area_t temp_area;
-    displayio_area_t *tile_area;
-    if (!self->partial_change) {
-        tile_area = &self->dirty_area;
-    } else {
-        tile_area = &temp_area;
-    }
+    displayio_area_t tile_area;
     int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
+    tile_area.x1 = tx * self->tile_width;
+    tile_area.x2 = tile_area.x1 + self->tile_width;
     int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
+    tile_area.y1 = ty * self->tile_height;
+    tile_area.y2 = tile_area.y1 + self->tile_height;
 
-    if (self->partial_change) {
-        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
+    if (!self->partial_change) {
+        self->dirty_area_count = 0;
     }
+    self->dirty_area_count = displayio_area_list_add(self->dirty_areas, self->dirty_area_count,
+        CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT, &tile_area);
 
     self->partial_change = true;
 }
@@ -355,10 +384,215 @@ bool common_hal_displayio_tilegrid_contains(displayio_tilegrid_t *self, uint16_t
            y >= self->y && y < bottom_edge;
 }
 
+// Records that the drawn rows shift by dy so a display that can move its pixels only needs to
+// redraw the rows scrolled into view. Pending dirty areas move along with the pixels.
+static void _scroll(displayio_tilegrid_t *self, int16_t dy) {
+    int32_t scroll_dy = self->scroll_dy + dy;
+    if (scroll_dy <= -self->pixel_height || scroll_dy >= self->pixel_height) {
+        self->full_change = true;
+        return;
+    }
+    if (!self->partial_change) {
+        self->dirty_area_count = 0;
+    }
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+        displayio_area_t *area = &self->dirty_areas[i];
+        area->y1 = MAX(0, MIN(self->pixel_height, area->y1 + dy));
+        area->y2 = MAX(0, MIN(self->pixel_height, area->y2 + dy));
+        if (!displayio_area_empty(area)) {
+            displayio_area_copy(area, &self->dirty_areas[count]);
+            count++;
+        }
+    }
+    displayio_area_t exposed = {0, 0, self->pixel_width, dy, NULL};
+    if (dy < 0) {
+        exposed.y1 = self->pixel_height + dy;
+        exposed.y2 = self->pixel_height;
+    }
+    self->dirty_area_count = displayio_area_list_add(self->dirty_areas, count,
+        CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT, &exposed);
+    self->scroll_dy = scroll_dy;
+    self->partial_change = true;
+}
+
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
+    if (x == self->top_left_x && !self->full_change && !self->moved) {
+        // Scroll the shorter way around.
+        int32_t rows = ((int32_t)y - self->top_left_y) % self->height_in_tiles;
+        if (rows < 0) {
+            rows += self->height_in_tiles;
+        }
+        if (rows > self->height_in_tiles / 2) {
+            rows -= self->height_in_tiles;
+        }
+        if (rows != 0) {
+            _scroll(self, -rows * self->tile_height);
+        }
+    } else {
+        self->full_change = true;
+    }
     self->top_left_x = x;
     self->top_left_y = y;
-    self->full_change = true;
+}
+
+// Number of pixels resolved at a time by the span fill. One mask word's worth keeps the scratch
+// buffers small enough for the stack.
+#define TILEGRID_SPAN_CHUNK (32)
+
+typedef enum {
+    TILEGRID_SHADER_NONE,
+    TILEGRID_SHADER_PALETTE,
+    // Undithered palette, resolved through its native color table.
+    TILEGRID_SHADER_PALETTE_TABLE,
+    TILEGRID_SHADER_COLORCONVERTER,
+    TILEGRID_SHADER_UNKNOWN,
+} tilegrid_shader_kind_t;
+
+// Returns one bit per pixel of the run (bit 0 first) for pixels whose mask bit is still clear.
+static uint32_t _mask_unset(const uint32_t *mask, int32_t offset, int16_t x_stride, uint16_t count) {
+    uint32_t all = count == 32 ? 0xffffffff : (1u << count) - 1;
+    if (x_stride == 1) {
+        uint32_t shift = offset % 32;
+        uint32_t set = mask[offset / 32] >> shift;
+        if (shift != 0 && shift + count > 32) {
+            set |= mask[offset / 32 + 1] << (32 - shift);
+        }
+        return ~set & all;
+    }
+    uint32_t unset = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        uint32_t o = offset + i * x_stride;
+        if ((mask[o / 32] & (1u << (o % 32))) == 0) {
+            unset |= 1u << i;
+        }
+    }
+    return unset;
+}
+
+// Sets the mask bits for the pixels of the run selected by bits.
+static void _mask_set(uint32_t *mask, int32_t offset, int16_t x_stride, uint32_t bits) {
+    if (x_stride == 1) {
+        uint32_t shift = offset % 32;
+        mask[offset / 32] |= bits << shift;
+        if (shift != 0 && (bits >> (32 - shift)) != 0) {
+            mask[offset / 32 + 1] |= bits >> (32 - shift);
+        }
+        return;
+    }
+    for (uint16_t i = 0; bits != 0; i++, bits >>= 1) {
+        if (bits & 1) {
+            uint32_t o = offset + i * x_stride;
+            mask[o / 32] |= 1u << (o % 32);
+        }
+    }
+}
+
+// Fills count pixels that all come from the same tile row. The destination moves by x_stride
+// (1 or -1) per pixel starting at offset. Pixels drawn are only added to mask when track_coverage
+// is set. Returns false if any pixel drawn was transparent.
+static bool _fill_span(displayio_tilegrid_t *self, bool on_disk, tilegrid_shader_kind_t shader,
+    const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel,
+    uint16_t count, int32_t offset, int16_t x_stride, bool track_coverage, uint32_t *mask, uint32_t *buffer) {
+    bool full_coverage = true;
+    uint32_t values[TILEGRID_SPAN_CHUNK];
+    while (count > 0) {
+        uint16_t chunk = MIN(count, TILEGRID_SPAN_CHUNK);
+
+        // Pixels already set by a layer above us are left alone.
+        uint32_t todo = _mask_unset(mask, offset, x_stride, chunk);
+
+        if (todo != 0) {
+            if (on_disk) {
+                displayio_ondiskbitmap_fill_row(self->bitmap, input_pixel->tile_x, input_pixel->tile_y, chunk, values);
+            } else {
+                displayio_bitmap_read_row(self->bitmap, input_pixel->tile_x, input_pixel->tile_y, chunk, values);
+            }
+
+            if (shader == TILEGRID_SHADER_PALETTE_TABLE) {
+                displayio_palette_t *palette = self->pixel_shader;
+                const uint32_t *native_colors = displayio_palette_get_native_colors(palette, colorspace);
+                for (uint16_t i = 0; i < chunk; i++) {
+                    uint32_t index = values[i];
+                    if (index >= palette->color_count || palette->colors[index].transparent) {
+                        if (todo & (1u << i)) {
+                            full_coverage = false;
+                            todo &= ~(1u << i);
+                        }
+                        continue;
+                    }
+                    values[i] = native_colors[index];
+                }
+            } else if (shader != TILEGRID_SHADER_NONE) {
+                displayio_output_pixel_t output_pixel;
+                uint16_t x = input_pixel->x;
+                uint16_t tile_x = input_pixel->tile_x;
+                for (uint16_t i = 0; i < chunk; i++) {
+                    if ((todo & (1u << i)) == 0) {
+                        continue;
+                    }
+                    // Dithering depends on the source location.
+                    input_pixel->x = x + i;
+                    input_pixel->tile_x = tile_x + i;
+                    input_pixel->pixel = values[i];
+                    output_pixel.pixel = 0;
+                    output_pixel.opaque = true;
+                    if (shader == TILEGRID_SHADER_PALETTE) {
+                        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, &output_pixel);
+                    } else if (shader == TILEGRID_SHADER_COLORCONVERTER) {
+                        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, &output_pixel);
+                    }
+                    if (!output_pixel.opaque) {
+                        full_coverage = false;
+                        todo &= ~(1u << i);
+                    }
+                    values[i] = output_pixel.pixel;
+                }
+                input_pixel->x = x;
+                input_pixel->tile_x = tile_x;
+            }
+
+            switch (colorspace->depth) {
+                case 16:
+                    for (uint16_t i = 0; i < chunk; i++) {
+                        if (todo & (1u << i)) {
+                            *(((uint16_t *)buffer) + offset + i * x_stride) = values[i];
+                        }
+                    }
+                    break;
+                case 32:
+                    for (uint16_t i = 0; i < chunk; i++) {
+                        if (todo & (1u << i)) {
+                            *(buffer + offset + i * x_stride) = values[i];
+                        }
+                    }
+                    break;
+                case 24:
+                    for (uint16_t i = 0; i < chunk; i++) {
+                        if (todo & (1u << i)) {
+                            memcpy(((uint8_t *)buffer) + (offset + i * x_stride) * 3, &values[i], 3);
+                        }
+                    }
+                    break;
+                case 8:
+                    for (uint16_t i = 0; i < chunk; i++) {
+                        if (todo & (1u << i)) {
+                            *(((uint8_t *)buffer) + offset + i * x_stride) = values[i];
+                        }
+                    }
+                    break;
+            }
+            if (track_coverage) {
+                _mask_set(mask, offset, x_stride, todo);
+            }
+        }
+
+        input_pixel->x += chunk;
+        input_pixel->tile_x += chunk;
+        offset += chunk * x_stride;
+        count -= chunk;
+    }
+    return full_coverage;
 }
 
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
@@ -409,11 +643,9 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
-
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
+    // An opaque layer covering the whole area is the last one drawn into it, so the mask doesn't
+    // need to record which pixels it set.
+    bool track_coverage = !full_coverage || !_is_opaque(self, colorspace);
     displayio_area_t transformed;
     displayio_area_transform_within(flip_x != (self->absolute_transform->dx < 0), flip_y != (self->absolute_transform->dy < 0), self->transpose_xy != self->absolute_transform->transpose_xy,
         &overlap,
@@ -451,6 +683,54 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
+    // Unscaled, untransposed tile grids map each bitmap row segment to a contiguous run of buffer
+    // pixels. Resolve the tile and shader once per run instead of once per pixel. Packed
+    // (sub-byte) output depths take the general path below.
+    bool on_disk = mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type);
+    if (self->absolute_transform->scale == 1 &&
+        self->transpose_xy == self->absolute_transform->transpose_xy &&
+        colorspace->depth >= 8 &&
+        (on_disk || mp_obj_is_type(self->bitmap, &displayio_bitmap_type))) {
+        tilegrid_shader_kind_t shader = TILEGRID_SHADER_UNKNOWN;
+        if (self->pixel_shader == mp_const_none) {
+            shader = TILEGRID_SHADER_NONE;
+        } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+            displayio_palette_t *palette = self->pixel_shader;
+            bool table = !palette->dither && palette->native_colors != NULL;
+            shader = table ? TILEGRID_SHADER_PALETTE_TABLE : TILEGRID_SHADER_PALETTE;
+        } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+            shader = TILEGRID_SHADER_COLORCONVERTER;
+        }
+        uint16_t tile_x_in_row = start_x / self->tile_width;
+        uint16_t first_x_in_tile = start_x % self->tile_width;
+        uint16_t first_tile_column = (tile_x_in_row + self->top_left_x) % self->width_in_tiles;
+        for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
+            int32_t offset = start + (input_pixel.y - start_y + y_shift) * y_stride + x_shift * x_stride;
+            uint16_t tile_row = ((input_pixel.y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+            uint16_t y_in_tile = input_pixel.y % self->tile_height;
+            uint16_t tile_column = first_tile_column;
+            uint16_t x_in_tile = first_x_in_tile;
+            input_pixel.x = start_x;
+            while (input_pixel.x < end_x) {
+                uint16_t count = MIN(self->tile_width - x_in_tile, end_x - input_pixel.x);
+                input_pixel.tile = tiles[tile_row + tile_column];
+                input_pixel.tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile;
+                input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+                if (!_fill_span(self, on_disk, shader, colorspace, &input_pixel, count, offset, x_stride, track_coverage, mask, buffer)) {
+                    full_coverage = false;
+                }
+                // _fill_span advanced input_pixel.x past the run.
+                offset += count * x_stride;
+                x_in_tile = 0;
+                tile_column++;
+                if (tile_column == self->width_in_tiles) {
+                    tile_column = 0;
+                }
+            }
+        }
+        return full_coverage;
+    }
+
     for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
         int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
         int16_t local_y = input_pixel.y / self->absolute_transform->scale;
@@ -496,7 +776,9 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
+                if (track_coverage) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
                 if (colorspace->depth == 16) {
                     *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth == 32) {
@@ -533,6 +815,29 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     return full_coverage;
 }
 
+bool displayio_tilegrid_get_scroll(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace, displayio_area_t *area, int16_t *dx, int16_t *dy) {
+    bool first_draw = self->previous_area.x1 == self->previous_area.x2;
+    // Only an opaque TileGrid owns every pixel in its area so that shifting them is safe.
+    if (self->scroll_dy == 0 || self->full_change || self->moved || first_draw ||
+        !displayio_tilegrid_get_opaque_area(self, colorspace, area)) {
+        return false;
+    }
+    // Transform the shift the same way _transform_dirty_area does a point.
+    int16_t x = 0;
+    int16_t y = self->flip_y ? -self->scroll_dy : self->scroll_dy;
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        x = y;
+        y = 0;
+    }
+    *dx = self->absolute_transform->dx * x;
+    *dy = self->absolute_transform->dy * y;
+    return true;
+}
+
+void displayio_tilegrid_finish_scroll(displayio_tilegrid_t *self) {
+    self->scrolled = true;
+}
+
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -545,6 +850,8 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
+    self->scroll_dy = 0;
+    self->scrolled = false;
     if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -560,6 +867,50 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts a dirty area relative to our pixels into absolute display coordinates.
+static void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t *area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = area->x1;
+    int16_t x2 = area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = area->y1;
+    int16_t y2 = area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -573,10 +924,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             return tail;
         }
     } else if (self->moved && !first_draw) {
-        displayio_area_union(&self->previous_area, &self->current_area, &self->dirty_area);
-        if (displayio_area_size(&self->dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
-            self->dirty_area.next = tail;
-            return &self->dirty_area;
+        displayio_area_t *dirty_area = &self->dirty_areas[0];
+        displayio_area_union(&self->previous_area, &self->current_area, dirty_area);
+        if (displayio_area_size(dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
+            dirty_area->next = tail;
+            return dirty_area;
         }
         self->previous_area.next = tail;
         self->current_area.next = &self->previous_area;
@@ -588,9 +940,15 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         displayio_area_t *refresh_area = displayio_bitmap_get_refresh_areas(self->bitmap, tail);
         if (refresh_area != tail) {
             // Special case a TileGrid that shows a full bitmap and use its
-            // dirty area. Copy it to ours so we can transform it.
+            // dirty areas. Copy them to ours so we can transform them.
             if (self->tiles_in_bitmap == 1) {
-                displayio_area_copy(refresh_area, &self->dirty_area);
+                if (!self->partial_change) {
+                    self->dirty_area_count = 0;
+                }
+                for (const displayio_area_t *area = refresh_area; area != tail; area = area->next) {
+                    self->dirty_area_count = displayio_area_list_add(self->dirty_areas,
+                        self->dirty_area_count, CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT, area);
+                }
                 self->partial_change = true;
             } else {
                 self->full_change = true;
@@ -598,7 +956,8 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         }
     }
 
-    self->full_change = self->full_change ||
+    // Pixels that scrolled must be redrawn in place if the display didn't shift them.
+    self->full_change = self->full_change || (self->scroll_dy != 0 && !self->scrolled) ||
         (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
             displayio_palette_needs_refresh(self->pixel_shader)) ||
         (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
@@ -609,49 +968,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
+        for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+            _transform_dirty_area(self, &self->dirty_areas[i]);
+            self->dirty_areas[i].next = tail;
+            tail = &self->dirty_areas[i];
         }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
-        self->dirty_area.next = tail;
-        return &self->dirty_area;
     }
     return tail;
 }
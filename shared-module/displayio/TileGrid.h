@@ -30,9 +30,12 @@ typedef struct {
     uint16_t tile_height;
     uint16_t top_left_x;
     uint16_t top_left_y;
+    // Rows the drawn pixels have shifted by since the last refresh, in our own coordinates.
+    int16_t scroll_dy;
     uint8_t *tiles;
     const displayio_buffer_transform_t *absolute_transform;
-    displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    // Stored as relative areas until the refresh areas are fetched.
+    displayio_area_t dirty_areas[CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT];
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
     bool partial_change : 1;
@@ -46,7 +49,9 @@ typedef struct {
     bool hidden : 1;
     bool hidden_by_parent : 1;
     bool rendered_hidden : 1;
-    uint8_t padding : 6;
+    bool scrolled : 1; // The display shifted its pixels by scroll_dy for us.
+    uint8_t padding : 5;
+    uint8_t dirty_area_count;
 } displayio_tilegrid_t;
 
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
@@ -64,6 +69,15 @@ void displayio_tilegrid_update_transform(displayio_tilegrid_t *group, const disp
 // Fills in area with the maximum bounds of all related pixels in the last rendered frame. Returns
 // false if the tilegrid wasn't rendered in the last frame.
 bool displayio_tilegrid_get_previous_area(displayio_tilegrid_t *self, displayio_area_t *area);
+// Fills in area with the screen area the tilegrid draws every pixel of. Returns false if it may
+// leave any pixel transparent.
+bool displayio_tilegrid_get_opaque_area(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace, displayio_area_t *area);
+// Fills in area with the screen area whose pixels can be shifted by dx, dy to account for a change
+// of top left since the last refresh. Returns false if it must be redrawn instead.
+bool displayio_tilegrid_get_scroll(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace, displayio_area_t *area, int16_t *dx, int16_t *dy);
+// Called once the display has shifted the area from displayio_tilegrid_get_scroll so that only the
+// newly exposed rows are refreshed.
+void displayio_tilegrid_finish_scroll(displayio_tilegrid_t *self);
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self);
 
 bool displayio_tilegrid_get_rendered_hidden(displayio_tilegrid_t *self);
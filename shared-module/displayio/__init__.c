@@ -16,6 +16,7 @@
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/Group.h"
 #include "shared-bindings/displayio/Palette.h"
+#include "shared-module/displayio/RefreshStats.h"
 #include "shared-module/displayio/area.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/reload.h"
@@ -178,6 +179,8 @@ void common_hal_displayio_release_displays(void) {
 }
 
 void reset_displays(void) {
+    displayio_refreshstats_reset();
+
     // The SPI buses used by FourWires may be allocated on the heap so we need to move them inline.
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         mp_const_obj_t display_bus_type = display_buses[i].bus_base.type;
@@ -111,6 +111,14 @@ bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b)
            a->y2 == b->y2;
 }
 
+bool displayio_area_contains(const displayio_area_t *outer, const displayio_area_t *inner) {
+    if (displayio_area_empty(inner)) {
+        return true;
+    }
+    return outer->x1 <= inner->x1 && inner->x2 <= outer->x2 &&
+           outer->y1 <= inner->y1 && inner->y2 <= outer->y2;
+}
+
 // Original and whole must be in the same coordinate space.
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
@@ -139,3 +147,39 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Extra pixels we are willing to refresh to save a separate area. Every area costs a new window
+// on the display and a pass over the group tree.
+#define DIRTY_AREA_MERGE_SLACK (64)
+
+uint8_t displayio_area_list_add(displayio_area_t *areas, uint8_t count, uint8_t max_count,
+    const displayio_area_t *area) {
+    if (displayio_area_empty(area)) {
+        return count;
+    }
+    displayio_area_t pending;
+    displayio_area_copy(area, &pending);
+    while (true) {
+        // Find the area that grows the least when combined with the pending one.
+        int8_t best = -1;
+        int32_t best_waste = INT32_MAX;
+        for (uint8_t i = 0; i < count; i++) {
+            displayio_area_t u;
+            displayio_area_union(&areas[i], &pending, &u);
+            int32_t waste = (int32_t)displayio_area_size(&u) - displayio_area_size(&areas[i]) - displayio_area_size(&pending);
+            if (waste < best_waste) {
+                best = i;
+                best_waste = waste;
+            }
+        }
+        if (best < 0 || (best_waste > DIRTY_AREA_MERGE_SLACK && count < max_count)) {
+            break;
+        }
+        // Merge and retry since the larger area may now be worth merging with another.
+        displayio_area_union(&areas[best], &pending, &pending);
+        count--;
+        displayio_area_copy(&areas[count], &areas[best]);
+    }
+    displayio_area_copy(&pending, &areas[count]);
+    return count + 1;
+}
@@ -35,6 +35,11 @@ typedef struct {
 
 extern displayio_buffer_transform_t null_transform;
 
+// Maximum number of separate dirty areas tracked by a Bitmap or TileGrid.
+#ifndef CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT
+#define CIRCUITPY_DISPLAY_DIRTY_AREA_LIMIT (4)
+#endif
+
 bool displayio_area_empty(const displayio_area_t *a);
 void displayio_area_copy_coords(const displayio_area_t *src, displayio_area_t *dest);
 void displayio_area_canon(displayio_area_t *a);
@@ -51,6 +56,12 @@ uint16_t displayio_area_width(const displayio_area_t *area);
 uint16_t displayio_area_height(const displayio_area_t *area);
 uint32_t displayio_area_size(const displayio_area_t *area);
 bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b);
+// True when every pixel of inner is also in outer. Empty areas are in every area.
+bool displayio_area_contains(const displayio_area_t *outer, const displayio_area_t *inner);
+// Adds area to a list of count areas and returns the new count. Areas are merged when refreshing
+// their union costs little more than refreshing them separately, or when the list is full.
+uint8_t displayio_area_list_add(displayio_area_t *areas, uint8_t count, uint8_t max_count,
+    const displayio_area_t *area);
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
     const displayio_area_t *whole,
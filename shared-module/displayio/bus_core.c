@@ -48,6 +48,8 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
     self->always_toggle_chip_select = always_toggle_chip_select;
     self->SH1107_addressing = SH1107_addressing;
     self->address_little_endian = address_little_endian;
+    self->send_nonblocking = NULL;
+    self->wait_for_send = NULL;
 
     #if CIRCUITPY_PARALLELDISPLAYBUS
     if (mp_obj_is_type(bus, &paralleldisplaybus_parallelbus_type)) {
@@ -55,6 +57,10 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
         self->bus_free = common_hal_paralleldisplaybus_parallelbus_bus_free;
         self->begin_transaction = common_hal_paralleldisplaybus_parallelbus_begin_transaction;
         self->send = common_hal_paralleldisplaybus_parallelbus_send;
+        #if CIRCUITPY_PARALLELDISPLAYBUS_NONBLOCKING
+        self->send_nonblocking = common_hal_paralleldisplaybus_parallelbus_send_nonblocking;
+        self->wait_for_send = common_hal_paralleldisplaybus_parallelbus_wait_for_send;
+        #endif
         self->end_transaction = common_hal_paralleldisplaybus_parallelbus_end_transaction;
         self->collect_ptrs = common_hal_paralleldisplaybus_parallelbus_collect_ptrs;
     } else
@@ -65,6 +71,10 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
         self->bus_free = common_hal_fourwire_fourwire_bus_free;
         self->begin_transaction = common_hal_fourwire_fourwire_begin_transaction;
         self->send = common_hal_fourwire_fourwire_send;
+        #if CIRCUITPY_BUSIO_SPI_NONBLOCKING
+        self->send_nonblocking = common_hal_fourwire_fourwire_send_nonblocking;
+        self->wait_for_send = common_hal_fourwire_fourwire_wait_for_send;
+        #endif
         self->end_transaction = common_hal_fourwire_fourwire_end_transaction;
         self->collect_ptrs = common_hal_fourwire_fourwire_collect_ptrs;
     } else
@@ -101,6 +111,24 @@ void displayio_display_bus_end_transaction(displayio_display_bus_t *self) {
     self->end_transaction(self->bus);
 }
 
+bool displayio_display_bus_can_send_nonblocking(displayio_display_bus_t *self) {
+    return self->send_nonblocking != NULL;
+}
+
+void displayio_display_bus_send_nonblocking(displayio_display_bus_t *self, const uint8_t *data, uint32_t data_length) {
+    if (self->send_nonblocking == NULL) {
+        self->send(self->bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, data_length);
+        return;
+    }
+    self->send_nonblocking(self->bus, data, data_length);
+}
+
+void displayio_display_bus_wait_for_send(displayio_display_bus_t *self) {
+    if (self->wait_for_send != NULL) {
+        self->wait_for_send(self->bus);
+    }
+}
+
 void displayio_display_bus_set_region_to_update(displayio_display_bus_t *self, displayio_display_core_t *display, displayio_area_t *area) {
     uint16_t x1 = area->x1 + self->colstart;
     uint16_t x2 = area->x2 + self->colstart;
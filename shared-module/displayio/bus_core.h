@@ -20,6 +20,9 @@ typedef struct {
     display_bus_bus_free bus_free;
     display_bus_begin_transaction begin_transaction;
     display_bus_send send;
+    // Optional. NULL when the bus can only send while the caller waits.
+    display_bus_send_nonblocking send_nonblocking;
+    display_bus_wait_for_send wait_for_send;
     display_bus_end_transaction end_transaction;
     display_bus_collect_ptrs collect_ptrs;
     uint16_t ram_width;
@@ -47,6 +50,13 @@ bool displayio_display_bus_is_free(displayio_display_bus_t *self);
 bool displayio_display_bus_begin_transaction(displayio_display_bus_t *self);
 void displayio_display_bus_end_transaction(displayio_display_bus_t *self);
 
+// Pixel data sent with displayio_display_bus_send_nonblocking may still be going out when it
+// returns. Don't change the data or send anything else until displayio_display_bus_wait_for_send.
+// Buses that can't send in the background finish sending before returning.
+bool displayio_display_bus_can_send_nonblocking(displayio_display_bus_t *self);
+void displayio_display_bus_send_nonblocking(displayio_display_bus_t *self, const uint8_t *data, uint32_t data_length);
+void displayio_display_bus_wait_for_send(displayio_display_bus_t *self);
+
 void displayio_display_bus_set_region_to_update(displayio_display_bus_t *self, displayio_display_core_t *display, displayio_area_t *area);
 
 void release_display_bus(displayio_display_bus_t *self);
@@ -8,9 +8,9 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/RefreshStats.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -159,6 +159,13 @@ void displayio_display_core_finish_refresh(displayio_display_core_t *self) {
     self->last_refresh = supervisor_ticks_ms64();
 }
 
+bool displayio_display_core_scroll(displayio_display_core_t *self, displayio_scroll_fun scroll, void *display) {
+    if (self->full_refresh || self->current_group == NULL) {
+        return false;
+    }
+    return displayio_group_scroll(self->current_group, &self->colorspace, scroll, display);
+}
+
 void release_display_core(displayio_display_core_t *self) {
     if (self->current_group != NULL) {
         self->current_group->in_group = false;
@@ -171,7 +178,10 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self) {
 
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     if (self->current_group != NULL) {
-        return displayio_group_fill_area(self->current_group, &self->colorspace, area, mask, buffer);
+        uint32_t start = displayio_refreshstats_start();
+        bool full_coverage = displayio_group_fill_area(self->current_group, &self->colorspace, area, mask, buffer);
+        displayio_refreshstats_record_composite(start, displayio_area_size(area));
+        return full_coverage;
     }
     return false;
 }
@@ -48,6 +48,10 @@ void displayio_display_core_finish_refresh(displayio_display_core_t *self);
 
 void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 
+// Lets layers that scrolled since the last refresh have their pixels shifted on the display by
+// scroll rather than redrawn. Returns true if any were.
+bool displayio_display_core_scroll(displayio_display_core_t *self, displayio_scroll_fun scroll, void *display);
+
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
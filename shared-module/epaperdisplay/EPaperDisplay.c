@@ -13,6 +13,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/RefreshStats.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -357,8 +358,10 @@ static bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
                 // Can't acquire display bus; skip the rest of the data. Try next display.
                 return false;
             }
+            uint32_t start = displayio_refreshstats_start();
             self->bus.send(self->bus.bus, DISPLAY_DATA, self->chip_select, (uint8_t *)buffer, subrectangle_size_bytes);
             displayio_display_bus_end_transaction(&self->bus);
+            displayio_refreshstats_record_transfer(start, displayio_area_size(&subrectangle));
 
             // TODO(tannewt): Make refresh displays faster so we don't starve other
             // background tasks.
@@ -428,6 +431,7 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
     if (current_area == NULL) {
         return true;
     }
+    displayio_refreshstats_record_frame(current_area);
     if (self->acep) {
         epaperdisplay_epaperdisplay_start_refresh(self);
         _clean_area(self);
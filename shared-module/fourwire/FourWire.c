@@ -101,6 +101,10 @@ bool common_hal_fourwire_fourwire_begin_transaction(mp_obj_t obj) {
 void common_hal_fourwire_fourwire_send(mp_obj_t obj, display_byte_type_t data_type,
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length) {
     fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    #if CIRCUITPY_BUSIO_SPI_NONBLOCKING
+    // The data/command pin can't change while pixels are still going out.
+    common_hal_busio_spi_wait_for_write(self->bus);
+    #endif
     if (self->command.base.type == &mp_type_NoneType) {
         // When the data/command pin is not specified, we simulate a 9-bit SPI mode, by
         // adding a data/command bit to every byte, and then splitting the resulting data back
@@ -159,8 +163,31 @@ void common_hal_fourwire_fourwire_send(mp_obj_t obj, display_byte_type_t data_ty
     }
 }
 
+#if CIRCUITPY_BUSIO_SPI_NONBLOCKING
+void common_hal_fourwire_fourwire_send_nonblocking(mp_obj_t obj, const uint8_t *data, uint32_t data_length) {
+    fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    if (self->command.base.type == &mp_type_NoneType) {
+        // Without a data/command pin, each byte is sent with an extra bit so the data can't be
+        // sent as is.
+        common_hal_fourwire_fourwire_send(obj, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, data_length);
+        return;
+    }
+    common_hal_busio_spi_wait_for_write(self->bus);
+    common_hal_digitalio_digitalinout_set_value(&self->command, true);
+    common_hal_busio_spi_write_nonblocking(self->bus, data, data_length);
+}
+
+void common_hal_fourwire_fourwire_wait_for_send(mp_obj_t obj) {
+    fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_busio_spi_wait_for_write(self->bus);
+}
+#endif
+
 void common_hal_fourwire_fourwire_end_transaction(mp_obj_t obj) {
     fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    #if CIRCUITPY_BUSIO_SPI_NONBLOCKING
+    common_hal_busio_spi_wait_for_write(self->bus);
+    #endif
     if (self->chip_select.base.type != &mp_type_NoneType) {
         common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
     }
@@ -9,9 +9,9 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/RefreshStats.h"
 #include "shared-module/displayio/display_core.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
@@ -21,6 +21,7 @@
 #endif
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define fb_getter_default(method, default_value) \
@@ -193,6 +194,7 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         uint8_t *src = (uint8_t *)buffer;
         size_t rowsize = (subrectangle.x2 - subrectangle.x1) * self->core.colorspace.depth / 8;
 
+        uint32_t start = displayio_refreshstats_start();
         for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
             assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
             MARK_ROW_DIRTY(i);
@@ -200,6 +202,7 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
             dest += rowstride;
             src += rowsize;
         }
+        displayio_refreshstats_record_transfer(start, displayio_area_size(&subrectangle));
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
@@ -210,24 +213,83 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
     return true;
 }
 
+typedef struct {
+    framebufferio_framebufferdisplay_obj_t *self;
+    uint8_t *dirty_row_bitmask;
+} framebufferio_scroll_t;
+
+// Moves the pixels of area already in the framebuffer by dx, dy. The rows and columns shifted in
+// from outside the area are left for the refresh to draw.
+static bool _scroll_area(void *display, const displayio_area_t *area, int16_t dx, int16_t dy) {
+    framebufferio_scroll_t *scroll = display;
+    framebufferio_framebufferdisplay_obj_t *self = scroll->self;
+    uint8_t *dirty_row_bitmask = scroll->dirty_row_bitmask;
+
+    // Pixels outside the display were never drawn so they can't be shifted in.
+    displayio_area_t clipped;
+    if (!displayio_display_core_clip_area(&self->core, area, &clipped) ||
+        !displayio_area_equal(&clipped, area)) {
+        return false;
+    }
+    uint8_t depth = self->core.colorspace.depth;
+    if (depth < 8) {
+        // Only whole bytes of row packed pixels can be moved.
+        int div = 8 / depth;
+        if (!self->core.colorspace.pixels_in_byte_share_row ||
+            area->x1 % div != 0 || area->x2 % div != 0 || dx % div != 0) {
+            return false;
+        }
+    }
+    if (abs(dx) >= displayio_area_width(area) || abs(dy) >= displayio_area_height(area)) {
+        return false;
+    }
+    uint16_t width = displayio_area_width(area) - abs(dx);
+    uint16_t height = displayio_area_height(area) - abs(dy);
+
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
+    (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
+    buf += self->first_pixel_offset;
+
+    size_t rowstride = self->row_stride;
+    size_t rowsize = width * depth / 8;
+    uint8_t *dest = buf + (area->x1 + MAX(dx, 0)) * depth / 8;
+    uint8_t *src = buf + (area->x1 - MIN(dx, 0)) * depth / 8;
+    uint32_t start = displayio_refreshstats_start();
+    for (uint16_t j = 0; j < height; j++) {
+        // Work against the direction of travel so rows are read before they are overwritten.
+        int16_t i = dy > 0 ? area->y2 - 1 - j : area->y1 + j;
+        uint8_t *row_dest = dest + i * rowstride;
+        uint8_t *row_src = src + (i - dy) * rowstride;
+        assert(row_dest >= buf && row_dest + rowsize <= endbuf && row_src >= buf && row_src + rowsize <= endbuf);
+        MARK_ROW_DIRTY(i);
+        memmove(row_dest, row_src, rowsize);
+    }
+    displayio_refreshstats_record_transfer(start, width * height);
+    return true;
+}
+
 static void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
     self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
     if (!self->bufinfo.buf) {
         return;
     }
     displayio_display_core_start_refresh(&self->core);
+    bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
+    int row_count = transposed ? self->core.width : self->core.height;
+    uint8_t dirty_row_bitmask[(row_count + 7) / 8];
+    memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
+    framebufferio_scroll_t scroll = { self, dirty_row_bitmask };
+    bool scrolled = displayio_display_core_scroll(&self->core, _scroll_area, &scroll);
     const displayio_area_t *current_area = _get_refresh_areas(self);
-    if (current_area) {
-        bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
-        int row_count = transposed ? self->core.width : self->core.height;
-        uint8_t dirty_row_bitmask[(row_count + 7) / 8];
-        memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
-        self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
+    if (current_area || scrolled) {
+        displayio_refreshstats_record_frame(current_area);
         while (current_area != NULL) {
             _refresh_area(self, current_area, dirty_row_bitmask);
             current_area = current_area->next;
         }
+        uint32_t start = displayio_refreshstats_start();
         self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        displayio_refreshstats_record_transfer(start, 0);
     }
     displayio_display_core_finish_refresh(&self->core);
 }
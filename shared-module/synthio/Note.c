@@ -190,7 +190,7 @@ static uint32_t pitch_bend(uint32_t frequency_scaled, int32_t bend_value) {
 #define ONE MICROPY_FLOAT_CONST(1.)
 #define ALMOST_ONE (MICROPY_FLOAT_CONST(32767.) / 32768)
 
-uint32_t synthio_note_step(synthio_note_obj_t *self, int32_t sample_rate, int16_t dur, int16_t loudness[2]) {
+uint32_t synthio_note_step(synthio_note_obj_t *self, int32_t sample_rate, int16_t dur, int16_t loudness[2], int16_t end_loudness[2]) {
     int panning = synthio_block_slot_get_scaled(&self->panning, -ALMOST_ONE, ALMOST_ONE);
     int left_panning_scaled, right_panning_scaled;
     if (panning >= 0) {
@@ -206,6 +206,8 @@ uint32_t synthio_note_step(synthio_note_obj_t *self, int32_t sample_rate, int16_
     right_panning_scaled = (right_panning_scaled * amplitude) >> 15;
     loudness[0] = (loudness[0] * left_panning_scaled) >> 15;
     loudness[1] = (loudness[1] * right_panning_scaled) >> 15;
+    end_loudness[0] = (end_loudness[0] * left_panning_scaled) >> 15;
+    end_loudness[1] = (end_loudness[1] * right_panning_scaled) >> 15;
 
     if (self->ring_frequency_scaled != 0) {
         int ring_bend_value = synthio_block_slot_get_scaled(&self->ring_bend, -12, 12);
@@ -0,0 +1,172 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Wavetable.h"
+#include "shared-module/synthio/__init__.h"
+
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// How often the phasor recurrence is re-seeded to stop rounding errors from
+// accumulating over long waveforms.
+#define RESEED_INTERVAL (256)
+
+#define MIN_LEVEL_LENGTH (64)
+
+// Fourier series of one cycle of the waveform: the DC term, then cosine and
+// sine amplitudes for harmonics 1 to harmonics.
+static mp_float_t analyze(const int16_t *waveform, size_t n, uint16_t harmonics, mp_float_t *a, mp_float_t *b) {
+    mp_float_t dc = 0;
+    for (size_t i = 0; i < n; i++) {
+        dc += waveform[i];
+    }
+    for (uint16_t h = 1; h <= harmonics; h++) {
+        mp_float_t theta = 2 * MP_PI * h / n;
+        mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(theta), s = MICROPY_FLOAT_C_FUN(sin)(theta);
+        mp_float_t zr = 1, zi = 0, sum_a = 0, sum_b = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (i % RESEED_INTERVAL == 0) {
+                mp_float_t phase = 2 * MP_PI * ((h * i) % n) / n;
+                zr = MICROPY_FLOAT_C_FUN(cos)(phase);
+                zi = MICROPY_FLOAT_C_FUN(sin)(phase);
+            }
+            sum_a += waveform[i] * zr;
+            sum_b += waveform[i] * zi;
+            mp_float_t t = zr * c - zi * s;
+            zi = zr * s + zi * c;
+            zr = t;
+        }
+        a[h] = 2 * sum_a / n;
+        b[h] = 2 * sum_b / n;
+    }
+    return dc / n;
+}
+
+// Lanczos sigma factors taper the top harmonics, which keeps the Gibbs
+// overshoot of square and sawtooth waves from clipping.
+static void synthesize_level(int16_t *level, uint16_t length, uint16_t harmonics, mp_float_t dc,
+    const mp_float_t *a, const mp_float_t *b, mp_float_t *ka, mp_float_t *kb) {
+    for (uint16_t h = 1; h <= harmonics; h++) {
+        mp_float_t x = MP_PI * h / (harmonics + 1);
+        mp_float_t sigma = MICROPY_FLOAT_C_FUN(sin)(x) / x;
+        ka[h] = a[h] * sigma;
+        kb[h] = b[h] * sigma;
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        mp_float_t theta = 2 * MP_PI * i / length;
+        mp_float_t wr = MICROPY_FLOAT_C_FUN(cos)(theta), wi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        mp_float_t zr = wr, zi = wi, value = dc;
+        for (uint16_t h = 1; h <= harmonics; h++) {
+            value += ka[h] * zr + kb[h] * zi;
+            mp_float_t t = zr * wr - zi * wi;
+            zi = zr * wi + zi * wr;
+            zr = t;
+        }
+        int32_t rounded = (int32_t)MICROPY_FLOAT_C_FUN(nearbyint)(value);
+        level[i] = MIN(MAX(rounded, INT16_MIN), INT16_MAX);
+    }
+    // Guard samples so that interpolation can read one before and two past the end.
+    level[-1] = level[length - 1];
+    level[length] = level[0];
+    level[length + 1] = level[1];
+}
+
+void common_hal_synthio_wavetable_construct(synthio_wavetable_obj_t *self, const int16_t *waveform, size_t waveform_length, bool cubic) {
+    uint16_t length = 4;
+    while (length < 2 * waveform_length && length < SYNTHIO_WAVETABLE_MAX_LENGTH) {
+        length *= 2;
+    }
+    uint16_t harmonics = MIN(length / 4, waveform_length / 2);
+    uint8_t level_count = 0;
+    size_t table_length = 0;
+    while (harmonics >> level_count) {
+        uint8_t shift = level_count;
+        while (shift > 0 && (length >> shift) < MIN_LEVEL_LENGTH) {
+            shift--;
+        }
+        self->offset[level_count] = table_length;
+        self->shift[level_count] = SYNTHIO_FREQUENCY_SHIFT + shift;
+        table_length += (length >> shift) + 3;
+        level_count++;
+    }
+    self->table = m_new(int16_t, table_length);
+    self->length = length;
+    self->harmonics = harmonics;
+    self->level_count = level_count;
+    self->cubic = cubic;
+
+    mp_float_t *coefficients = m_new(mp_float_t, 4 * (harmonics + 1));
+    mp_float_t *a = coefficients, *b = a + harmonics + 1;
+    mp_float_t *ka = b + harmonics + 1, *kb = ka + harmonics + 1;
+    mp_float_t dc = analyze(waveform, waveform_length, harmonics, a, b);
+    for (uint8_t k = 0; k < level_count; k++) {
+        uint16_t level_length = length >> (self->shift[k] - SYNTHIO_FREQUENCY_SHIFT);
+        synthesize_level(self->table + self->offset[k] + 1, level_length, harmonics >> k, dc, a, b, ka, kb);
+    }
+    m_del(mp_float_t, coefficients, 4 * (harmonics + 1));
+}
+
+bool common_hal_synthio_wavetable_get_cubic(synthio_wavetable_obj_t *self) {
+    return self->cubic;
+}
+
+void common_hal_synthio_wavetable_get_buffer(synthio_wavetable_obj_t *self, mp_buffer_info_t *bufinfo) {
+    bufinfo->buf = self->table + 1;
+    bufinfo->len = self->length * sizeof(int16_t);
+    bufinfo->typecode = 'h';
+}
+
+bool synthio_wavetable_synthesize(const synthio_wavetable_obj_t *self, uint32_t *accum_in, uint32_t dds_rate, int32_t *out_buffer32, uint16_t dur) {
+    uint32_t lim = self->length << SYNTHIO_FREQUENCY_SHIFT;
+    // The highest harmonic of level k is (harmonics >> k) * dds_rate / lim
+    // cycles per sample, which has to stay under one half.
+    uint8_t k = 0;
+    while ((uint64_t)(self->harmonics >> k) * dds_rate >= lim / 2) {
+        if (++k == self->level_count) {
+            return false;
+        }
+    }
+    const int16_t *level = self->table + self->offset[k] + 1;
+    // The accumulator always counts in first level samples, so the phase
+    // carries over when a bend moves the note to another level.
+    uint8_t shift = self->shift[k];
+
+    uint32_t accum = *accum_in;
+    if (accum >= lim) {
+        accum %= lim;
+    }
+    if (self->cubic) {
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            if (accum >= lim) {
+                accum -= lim;
+            }
+            const int16_t *y = level + (accum >> shift);
+            // Catmull-Rom spline through y[-1] .. y[2], with the fraction in
+            // 11 bits and the coefficients doubled so they stay integers.
+            int32_t f = (accum >> (shift - 11)) & 0x7ff;
+            int32_t c1 = y[1] - y[-1];
+            int32_t c2 = 2 * y[-1] - 5 * y[0] + 4 * y[1] - y[2];
+            int32_t c3 = y[2] - y[-1] + 3 * (y[0] - y[1]);
+            int32_t value = ((((((c3 * f) >> 11) + c2) * f >> 11) + c1) * f >> 12) + y[0];
+            out_buffer32[i] = MIN(MAX(value, INT16_MIN), INT16_MAX);
+        }
+    } else {
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            if (accum >= lim) {
+                accum -= lim;
+            }
+            const int16_t *y = level + (accum >> shift);
+            int32_t f = (accum >> (shift - 15)) & 0x7fff;
+            out_buffer32[i] = y[0] + (((y[1] - y[0]) * f) >> 15);
+        }
+    }
+    *accum_in = accum;
+    return true;
+}
@@ -0,0 +1,32 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#define SYNTHIO_WAVETABLE_MAX_LENGTH (4096)
+#define SYNTHIO_WAVETABLE_MAX_LEVELS (12)
+
+// Each level holds half the harmonics of the one before in a table half as
+// long, so every level is sampled at twice its highest harmonic or more. The
+// last few levels are kept longer than that so that interpolating them stays
+// accurate. Levels are stored one after another with one guard sample before
+// and two after, so interpolation never has to wrap.
+typedef struct {
+    mp_obj_base_t base;
+    int16_t *table;
+    uint16_t length; // of the first level, a power of two
+    uint16_t harmonics; // in the first level
+    uint16_t offset[SYNTHIO_WAVETABLE_MAX_LEVELS];
+    uint8_t shift[SYNTHIO_WAVETABLE_MAX_LEVELS]; // from the accumulator to a sample index
+    uint8_t level_count;
+    bool cubic;
+} synthio_wavetable_obj_t;
+
+// Synthesizes dur samples of the level that stays below the Nyquist
+// frequency at dds_rate. Returns false if even a sine would alias.
+bool synthio_wavetable_synthesize(const synthio_wavetable_obj_t *self, uint32_t *accum, uint32_t dds_rate, int32_t *out_buffer32, uint16_t dur);
@@ -10,6 +10,7 @@
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/BlockBiquad.h"
 #include "shared-module/synthio/Note.h"
+#include "shared-bindings/synthio/Wavetable.h"
 #include "py/runtime.h"
 #include <math.h>
 #include <stdlib.h>
@@ -105,6 +106,14 @@ static void synthio_envelope_state_step(synthio_envelope_state_t *state, synthio
     }
 }
 
+// The level the envelope will have reached after n_steps more samples,
+// without advancing it.
+static int16_t synthio_envelope_state_peek(const synthio_envelope_state_t *state, synthio_envelope_definition_t *def, size_t n_steps) {
+    synthio_envelope_state_t next = *state;
+    synthio_envelope_state_step(&next, def, n_steps);
+    return next.level;
+}
+
 static void synthio_envelope_state_init(synthio_envelope_state_t *state, synthio_envelope_definition_t *def) {
     state->level = 0;
     state->substep = 0;
@@ -151,13 +160,14 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2], int16_t end_loudness[2]) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->sample_rate;
 
 
     uint32_t dds_rate;
+    mp_obj_t waveform_obj = synth->waveform_obj;
     const int16_t *waveform = synth->waveform_bufinfo.buf;
     uint32_t waveform_start = 0;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
@@ -179,8 +189,13 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         dds_rate = (sample_rate / 2 + ((uint64_t)(base_freq * waveform_length) << (SYNTHIO_FREQUENCY_SHIFT - 10 + octave))) / sample_rate;
     } else {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-        int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
+        int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness, end_loudness);
+        if ((loudness[0] | loudness[1] | end_loudness[0] | end_loudness[1]) == 0) {
+            // silent for the whole block, e.g. amplitude 0; skip rendering it
+            return false;
+        }
         if (note->waveform_buf.buf) {
+            waveform_obj = note->waveform_obj;
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
             waveform_start = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_start, 0, waveform_length - 1);
@@ -204,27 +219,35 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
     uint32_t accum = synth->accum[chan];
 
-    if (dds_rate > lim / 2) {
-        // beyond nyquist, can't play note
-        return false;
-    }
-
-    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-    if (accum > lim) {
-        accum = accum % lim + offset;
-    }
+    if (mp_obj_is_type(waveform_obj, &synthio_wavetable_type) && waveform_start == 0
+        && waveform_length == ((synthio_wavetable_obj_t *)MP_OBJ_TO_PTR(waveform_obj))->length) {
+        // band-limited and interpolated; only fails if even the plainest copy is beyond nyquist
+        if (!synthio_wavetable_synthesize(MP_OBJ_TO_PTR(waveform_obj), &synth->accum[chan], dds_rate, out_buffer32, dur)) {
+            return false;
+        }
+    } else {
+        if (dds_rate > lim / 2) {
+            // beyond nyquist, can't play note
+            return false;
+        }
 
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
         if (accum > lim) {
-            accum = accum - lim + offset;
+            accum = accum % lim + offset;
+        }
+
+        // first, fill with waveform
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+            out_buffer32[i] = waveform[idx];
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+        synth->accum[chan] = accum;
     }
-    synth->accum[chan] = accum;
 
     if (ring_dds_rate) {
         if (ring_dds_rate > lim / 2) {
@@ -269,15 +292,40 @@ static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
     return mp_const_none;
 }
 
-static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+// acc + (sample * (gain >> 16)) >> 16, in one instruction where available.
+// Only the whole part of the 16.16 gain is used, so a constant gain gives
+// the same result as multiplying by the 16 bit loudness directly.
+__attribute__((always_inline))
+static inline int32_t mul_add_gain(int32_t acc, int32_t sample, int32_t gain) {
+    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    asm volatile ("smlawt %0, %1, %2, %3" : "=r" (acc) : "r" (sample), "r" (gain), "r" (acc));
+    return acc;
+    #else
+    return acc + ((sample * (gain >> 16)) >> 16);
+    #endif
+}
+
+// The loudness moves in a straight line from loudness at the first sample to
+// end_loudness at the first sample of the next block, so envelopes change
+// smoothly instead of in steps once per block.
+static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], int16_t end_loudness[2], size_t dur, int synth_chan) {
+    int32_t gain0 = loudness[0] * 65536, gain1 = loudness[1] * 65536;
+    int32_t step0 = (end_loudness[0] - loudness[0]) * 65536 / (int32_t)dur;
+    int32_t step1 = (end_loudness[1] - loudness[1]) * 65536 / (int32_t)dur;
     if (synth_chan == 1) {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
+            *out_buffer32 = mul_add_gain(*out_buffer32, *tmp_buffer32++, gain0);
+            out_buffer32++;
+            gain0 += step0;
         }
     } else {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+            *out_buffer32 = mul_add_gain(*out_buffer32, *tmp_buffer32, gain0);
+            out_buffer32++;
+            *out_buffer32 = mul_add_gain(*out_buffer32, *tmp_buffer32++, gain1);
+            out_buffer32++;
+            gain0 += step0;
+            gain1 += step1;
         }
     }
 }
@@ -315,11 +363,14 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
             continue;
         }
 
-        int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
+        int16_t level = synth->envelope_state[chan].level;
+        int16_t end_level = synthio_envelope_state_peek(&synth->envelope_state[chan], synthio_synth_get_note_envelope(synth, note_obj), dur);
+        int16_t loudness[2] = {level, level};
+        int16_t end_loudness[2] = {end_level, end_level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
-            // for some other reason, such as being above nyquist, note
-            // couldn't be synthed, so don't filter or sum it in
+        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness, end_loudness)) {
+            // for some other reason, such as being silent or above nyquist,
+            // note couldn't be synthed, so don't filter or sum it in
             continue;
         }
 
@@ -333,7 +384,7 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         }
 
         // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
+        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, end_loudness, dur, synth->channel_count);
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
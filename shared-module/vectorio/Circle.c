@@ -44,6 +44,34 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+// Largest root with root * root <= value.
+static uint32_t isqrt(uint32_t value) {
+    uint32_t root = 0;
+    for (uint32_t bit = 1u << 30; bit != 0; bit >>= 2) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+    }
+    return root;
+}
+
+uint16_t common_hal_vectorio_circle_get_spans(void *obj, int16_t y, vectorio_span_t *spans, uint16_t max_spans) {
+    vectorio_circle_t *self = obj;
+    int16_t radius = self->radius;
+    y = abs(y);
+    if (y > radius || max_spans == 0) {
+        return 0;
+    }
+    // Matches get_pixel: x is covered when x * x + y * y <= radius * radius.
+    int16_t half_width = isqrt((int32_t)radius * radius - (int32_t)y * y);
+    spans[0].x1 = -half_width;
+    spans[0].x2 = half_width + 1;
+    return 1;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
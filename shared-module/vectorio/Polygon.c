@@ -39,6 +39,9 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
     self->points_list = NULL;
     self->len = 0;
 
+    // There is one edge per point.
+    self->crossings = gc_realloc(self->crossings, len * sizeof(vectorio_polygon_crossing_t), true);
+
     for (uint16_t i = 0; i < len; ++i) {
         size_t tuple_len = 0;
         mp_obj_t *tuple_items;
@@ -64,6 +67,7 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t points_list, uint16_t color_index) {
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
+    self->crossings = NULL;
     self->len = 0;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
@@ -185,6 +189,80 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Sign-correct ceiling of numerator / denominator.
+static inline int32_t ceil_div(int32_t numerator, int32_t denominator) {
+    int32_t quotient = numerator / denominator;
+    if ((numerator % denominator != 0) && ((numerator < 0) == (denominator < 0))) {
+        quotient += 1;
+    }
+    return quotient;
+}
+
+uint16_t common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, vectorio_span_t *spans, uint16_t max_spans) {
+    vectorio_polygon_t *self = obj;
+
+    if (self->len == 0) {
+        return 0;
+    }
+
+    // Every edge that crosses row y changes the winding number of the pixels left of it. Using the
+    // same comparisons as get_pixel, an edge from (x1, y1) to (x2, y2) winds pixels with
+    // (x - x1) * (y2 - y1) on the inside of (y - y1) * (x2 - x1), which is every x less than the
+    // crossing computed here.
+    uint16_t crossing_count = 0;
+    int16_t x1 = self->points_list[self->len - 2];
+    int16_t y1 = self->points_list[self->len - 1];
+    for (uint16_t i = 0; i < self->len; i += 2) {
+        int16_t x2 = self->points_list[i];
+        int16_t y2 = self->points_list[i + 1];
+        int8_t winding = 0;
+        if (y1 <= y && y2 > y) {
+            winding = 1;
+        } else if (y1 > y && y2 <= y) {
+            winding = -1;
+        }
+        if (winding != 0) {
+            vectorio_polygon_crossing_t crossing = {
+                .x = x1 + ceil_div((y - y1) * (x2 - x1), y2 - y1),
+                .winding = winding,
+            };
+            // Insertion sort since there are usually only a couple of crossings.
+            uint16_t j = crossing_count;
+            while (j > 0 && self->crossings[j - 1].x > crossing.x) {
+                self->crossings[j] = self->crossings[j - 1];
+                j--;
+            }
+            self->crossings[j] = crossing;
+            crossing_count++;
+        }
+        x1 = x2;
+        y1 = y2;
+    }
+
+    // Left of every crossing the winding number is zero. Walk right and emit runs where it isn't.
+    uint16_t span_count = 0;
+    int16_t winding_number = 0;
+    for (uint16_t i = 0; i < crossing_count; i++) {
+        int32_t x = self->crossings[i].x;
+        if (winding_number != 0 && x > self->crossings[i - 1].x) {
+            int16_t span_start = MAX(self->crossings[i - 1].x, SHRT_MIN);
+            int16_t span_end = MIN(x, SHRT_MAX);
+            if (span_count > 0 && spans[span_count - 1].x2 == span_start) {
+                spans[span_count - 1].x2 = span_end;
+            } else if (span_count == max_spans) {
+                return max_spans + 1;
+            } else {
+                spans[span_count].x1 = span_start;
+                spans[span_count].x2 = span_end;
+                span_count++;
+            }
+        }
+        // Pixels at and right of the crossing are no longer wound by its edge.
+        winding_number -= self->crossings[i].winding;
+    }
+    return span_count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
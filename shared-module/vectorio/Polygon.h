@@ -11,10 +11,18 @@
 #include "py/obj.h"
 #include "shared-module/vectorio/__init__.h"
 
+typedef struct {
+    int32_t x;
+    int8_t winding;
+} vectorio_polygon_crossing_t;
+
 typedef struct {
     mp_obj_base_t base;
     // An int array[ x, y, ... ]
     int16_t *points_list;
+    // Scratch space for one crossing per edge while computing spans. Allocated with the points
+    // because spans are computed during refresh when we can't allocate.
+    vectorio_polygon_crossing_t *crossings;
     uint16_t len;
     uint16_t color_index;
     vectorio_event_t on_dirty;
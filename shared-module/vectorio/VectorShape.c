@@ -32,6 +32,9 @@
 #define VECTORIO_SHAPE_PIXEL_DEBUG(...) (void)0
 // #define VECTORIO_SHAPE_PIXEL_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// The most runs of pixels a shape row can have before falling back to checking each pixel.
+#define VECTORIO_MAX_SPANS (16)
+
 #define U32_TO_BINARY_FMT "%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c"
 #define U32_TO_BINARY(u32)  \
     (u32 & 0x80000000 ? '1' : '0'), \
@@ -326,6 +329,95 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+bool vectorio_vector_shape_get_bounds(vectorio_vector_shape_t *self, displayio_area_t *out_area) {
+    if (self->hidden) {
+        return false;
+    }
+    displayio_area_copy(&self->current_area, out_area);
+    return true;
+}
+
+// Draws a shape pixel value at a screen row and column unless the mask shows a layer above has
+// already drawn there. color is the converted shape pixel when it doesn't depend on position, or
+// NULL to convert it here. Returns false if the pixel is uncovered or transparent.
+static bool _fill_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, bool transposed, int16_t row, int16_t column, uint32_t shape_pixel, const displayio_output_pixel_t *color, uint32_t *mask, uint32_t *buffer) {
+    displayio_input_pixel_t input_pixel;
+    displayio_output_pixel_t output_pixel;
+    input_pixel.x = transposed ? row : column;
+    input_pixel.y = transposed ? column : row;
+    // Dithering is seeded by the tile position. Shapes aren't tiled so use the screen position.
+    input_pixel.tile_x = input_pixel.x;
+    input_pixel.tile_y = input_pixel.y;
+
+    uint16_t linestride_px = displayio_area_width(area);
+    uint16_t pixel_index = (input_pixel.y - area->y1) * linestride_px + (input_pixel.x - area->x1);
+    uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+    uint8_t mask_bit = pixel_index % 32;
+    VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
+    if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
+        return true;
+    }
+    VECTORIO_SHAPE_PIXEL_DEBUG(" (%3d, %3d) -> %d", input_pixel.x, input_pixel.y, shape_pixel);
+
+    // vectorio shapes use 0 to mean "area is not covered."
+    // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
+    if (shape_pixel == 0) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
+        return false;
+    }
+    if (color != NULL) {
+        output_pixel = *color;
+    } else {
+        // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
+        input_pixel.pixel = shape_pixel - 1;
+        output_pixel.pixel = 0;
+        output_pixel.opaque = true;
+
+        if (self->pixel_shader == mp_const_none) {
+            output_pixel.pixel = input_pixel.pixel;
+        } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+            displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+        } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+            displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+        }
+    }
+
+    *mask_doubleword |= 1u << mask_bit;
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
+        *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
+        *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
+        *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t pixel_row = pixel_index / linestride_px;
+            uint16_t pixel_column = pixel_index % linestride_px;
+            pixel_index = pixel_column * pixels_per_byte + (pixel_row / pixels_per_byte) * pixels_per_byte * linestride_px + pixel_row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+    }
+
+    // A transparent shader color still claims the pixel but doesn't cover it.
+    if (!output_pixel.opaque) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+        return false;
+    }
+    return true;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -354,108 +446,122 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
         self->absolute_transform->width, self->absolute_transform->height, self->absolute_transform->mirror_x, self->absolute_transform->mirror_y, self->absolute_transform->transpose_xy
         );
 
-    uint16_t linestride_px = displayio_area_width(area);
-    uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
-    uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
-    VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
-
-    displayio_input_pixel_t input_pixel;
-    displayio_output_pixel_t output_pixel;
-
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
-
-    uint16_t mask_start_px = line_dirty_offset_px;
-    for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
-        mask_start_px += column_dirty_offset_px;
-        for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
-            // Check the mask first to see if the pixel has already been set.
-            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
-            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
-            uint8_t mask_bit = pixel_index % 32;
-            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
-            if ((*mask_doubleword & (1u << mask_bit)) != 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
-                continue;
-            }
-            output_pixel.pixel = 0;
-
-            // Cast input screen coordinates to shape coordinates to pick the pixel to draw
-            int16_t pixel_to_get_x;
-            int16_t pixel_to_get_y;
-            screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
-
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t pre_pixel = common_hal_time_monotonic_ns();
-            #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t post_pixel = common_hal_time_monotonic_ns();
-            pixel_time += post_pixel - pre_pixel;
-            #endif
-            VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
-
-            // vectorio shapes use 0 to mean "area is not covered."
-            // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
-            if (input_pixel.pixel == 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
-                full_coverage = false;
-            } else {
-                // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
-                input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+    VECTORIO_SHAPE_DEBUG(", depth:%2d shape:%s", colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
+
+    // Shape rows run along screen rows, or along screen columns when transposed. Each one is filled
+    // from the runs of pixels the shape covers rather than asking the shape about every pixel.
+    bool transposed = self->absolute_transform->transpose_xy;
+    int16_t row_start = transposed ? overlap.x1 : overlap.y1;
+    int16_t row_end = transposed ? overlap.x2 : overlap.y2;
+    int16_t column_start = transposed ? overlap.y1 : overlap.x1;
+    int16_t column_end = transposed ? overlap.y2 : overlap.x2;
+
+    vectorio_span_t spans[VECTORIO_MAX_SPANS];
+    // Every covered pixel of a shape has the same value so only look it up once. Its color is the
+    // same everywhere too unless the shader dithers.
+    uint32_t shape_pixel = 0;
+    displayio_output_pixel_t span_color = {.pixel = 0, .opaque = true};
+    bool dither = false;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        dither = common_hal_displayio_palette_get_dither(self->pixel_shader);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        dither = common_hal_displayio_colorconverter_get_dither(self->pixel_shader);
+    }
+    for (int16_t row = row_start; row < row_end; row++) {
+        int16_t shape_x;
+        int16_t shape_y;
+        int16_t next_shape_x;
+        int16_t next_shape_y;
+        if (transposed) {
+            screen_to_shape_coordinates(self, row, column_start, &shape_x, &shape_y);
+            screen_to_shape_coordinates(self, row, column_start + 1, &next_shape_x, &next_shape_y);
+        } else {
+            screen_to_shape_coordinates(self, column_start, row, &shape_x, &shape_y);
+            screen_to_shape_coordinates(self, column_start + 1, row, &next_shape_x, &next_shape_y);
+        }
+        // Mirroring makes shape x decrease as the screen column increases.
+        bool reversed = next_shape_x < shape_x;
+
+        #ifdef VECTORIO_PERF
+        uint64_t pre_pixel = common_hal_time_monotonic_ns();
+        #endif
+        uint16_t span_count = VECTORIO_MAX_SPANS + 1;
+        if (self->ishape.get_spans != NULL) {
+            span_count = self->ishape.get_spans(self->ishape.shape, shape_y, spans, VECTORIO_MAX_SPANS);
+        }
+        #ifdef VECTORIO_PERF
+        uint64_t post_pixel = common_hal_time_monotonic_ns();
+        pixel_time += post_pixel - pre_pixel;
+        #endif
+
+        if (span_count > VECTORIO_MAX_SPANS) {
+            // Too many runs to hold so ask the shape about each pixel instead.
+            for (int16_t column = column_start; column < column_end; column++) {
+                int16_t offset = column - column_start;
+                uint32_t pixel = self->ishape.get_pixel(self->ishape.shape, reversed ? shape_x - offset : shape_x + offset, shape_y);
+                if (!_fill_pixel(self, colorspace, area, transposed, row, column, pixel, NULL, mask, buffer)) {
+                    full_coverage = false;
                 }
+            }
+            continue;
+        }
 
-                // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+        int16_t covered_to = column_start;
+        for (uint16_t i = 0; i <= span_count; i++) {
+            int32_t span_start = column_end;
+            int32_t span_end = column_end;
+            if (i < span_count) {
+                // Convert the span to screen columns, visiting them left to right.
+                const vectorio_span_t *span = &spans[reversed ? span_count - 1 - i : i];
+                if (reversed) {
+                    span_start = column_start + shape_x - span->x2 + 1;
+                    span_end = column_start + shape_x - span->x1 + 1;
+                } else {
+                    span_start = column_start + span->x1 - shape_x;
+                    span_end = column_start + span->x2 - shape_x;
+                }
+                span_start = MAX(span_start, covered_to);
+                span_end = MIN(span_end, column_end);
+                if (span_start >= span_end) {
+                    continue;
+                }
+            }
+            // Pixels between spans are uncovered. They only matter if nothing else has drawn them.
+            for (int16_t column = covered_to; full_coverage && column < span_start; column++) {
+                if (!_fill_pixel(self, colorspace, area, transposed, row, column, 0, NULL, mask, buffer)) {
                     full_coverage = false;
                 }
-
-                *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+            }
+            if (i == span_count) {
+                break;
+            }
+            if (shape_pixel == 0) {
+                int16_t offset = span_start - column_start;
+                shape_pixel = self->ishape.get_pixel(self->ishape.shape, reversed ? shape_x - offset : shape_x + offset, shape_y);
+                if (!dither) {
+                    displayio_input_pixel_t input_pixel = {.pixel = shape_pixel - 1};
+                    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+                        displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &span_color);
+                    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+                        displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &span_color);
+                    } else {
+                        span_color.pixel = input_pixel.pixel;
                     }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
                 }
             }
+            for (int16_t column = span_start; column < span_end; column++) {
+                if (!_fill_pixel(self, colorspace, area, transposed, row, column, shape_pixel, dither ? NULL : &span_color, mask, buffer)) {
+                    full_coverage = false;
+                }
+            }
+            covered_to = span_end;
         }
-        mask_start_px += linestride_px - column_dirty_offset_px;
     }
     #ifdef VECTORIO_PERF
     uint64_t end = common_hal_time_monotonic_ns();
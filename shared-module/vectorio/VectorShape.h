@@ -13,9 +13,13 @@
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
+#include "shared-module/vectorio/__init__.h"
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Fills spans with the covered runs of shape row y from left to right and returns how many there
+// are. Returns more than max_spans when they don't fit.
+typedef uint16_t get_spans_function(mp_obj_t shape, int16_t y, vectorio_span_t *spans, uint16_t max_spans);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +31,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans;
 } vectorio_ishape_t;
 
 typedef struct {
@@ -55,4 +60,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 // Fills in out_area with the maximum bounds of all related pixels in the last rendered frame. Returns
 // false if the vector shape wasn't rendered in the last frame.
 bool vectorio_vector_shape_get_previous_area(vectorio_vector_shape_t *self, displayio_area_t *out_area);
+// Fills in out_area with the screen area the shape currently draws within. Returns false if the
+// shape draws nothing.
+bool vectorio_vector_shape_get_bounds(vectorio_vector_shape_t *self, displayio_area_t *out_area);
 void vectorio_vector_shape_finish_refresh(vectorio_vector_shape_t *self);
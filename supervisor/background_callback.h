@@ -7,6 +7,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /** Background callbacks are a linked list of tasks to call in the background.
  *
@@ -25,7 +26,14 @@
  * very next background-tasks invocation, leading to a CircuitPython freeze, so
  * don't do that.
  *
- * background_callback_add can be called from interrupt context.
+ * background_callback_add can be called from interrupt context. Where the CPU
+ * has atomic compare-and-swap, queueing is lock-free and never disables
+ * interrupts.
+ *
+ * Each callback has a priority class. Queued high priority callbacks (such as
+ * audio buffer refills) run first, and are also run between the callbacks of
+ * lower classes if they are queued while those run. Low priority callbacks
+ * (such as display updates) run last.
  *
  * If your work isn't triggered by an event, then it may be better implemented
  * using ticks, which runs tasks every millisecond or so. Ticks are enabled with
@@ -33,15 +41,37 @@
  * enabled, a timer will schedule a callback to supervisor_background_tick(),
  * which includes port_background_tick(), every millisecond.
  */
+
+/* Set CIRCUITPY_BACKGROUND_CALLBACK_STATS to record how long each callback
+ * waits between being queued and being run, in mp_hal_ticks_us units. */
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_STATS
+#define CIRCUITPY_BACKGROUND_CALLBACK_STATS (0)
+#endif
+
+typedef enum {
+    BACKGROUND_CALLBACK_PRIORITY_NORMAL, // the default for a zeroed callback
+    BACKGROUND_CALLBACK_PRIORITY_HIGH,
+    BACKGROUND_CALLBACK_PRIORITY_LOW,
+    BACKGROUND_CALLBACK_NUM_PRIORITIES,
+} background_callback_priority_t;
+
 typedef void (*background_callback_fun)(void *data);
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
-    struct background_callback *prev;
+    volatile uint8_t queued;
+    uint8_t priority;
+    #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+    uint32_t queued_at;
+    uint32_t latency_max;
+    uint32_t latency_total;
+    uint32_t run_count;
+    #endif
 } background_callback_t;
 
-/* Add a background callback for which 'fun' and 'data' were previously set */
+/* Add a background callback for which 'fun', 'data' and 'priority' were
+ * previously set */
 void background_callback_add_core(background_callback_t *cb);
 
 /* Add a background callback to the given function with the given data.  When
@@ -53,6 +83,15 @@ void background_callback_add_core(background_callback_t *cb);
  */
 void background_callback_add(background_callback_t *cb, background_callback_fun fun, void *data);
 
+/* As background_callback_add, but in the given priority class instead of
+ * BACKGROUND_CALLBACK_PRIORITY_NORMAL. */
+void background_callback_add_priority(background_callback_t *cb, background_callback_fun fun, void *data, background_callback_priority_t priority);
+
+/* True when the given callback is queued and has not started running yet. */
+static inline bool background_callback_queued(const background_callback_t *cb) {
+    return cb->queued;
+}
+
 /* Run all background callbacks.  Normally, this is done by the supervisor
  * whenever the list is non-empty */
 void background_callback_run_all(void);
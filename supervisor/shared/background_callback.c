@@ -12,147 +12,261 @@
 #include "supervisor/linker.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
-#include "shared-bindings/microcontroller/__init__.h"
 
-static volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+// Use atomic operations when they don't need a lock (eg not on Cortex-M0),
+// otherwise fall back to disabling interrupts around each operation.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+#define CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE (__GCC_ATOMIC_POINTER_LOCK_FREE == 2 && __GCC_ATOMIC_CHAR_LOCK_FREE == 2)
+#endif
 
+#if !CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+#include "shared-bindings/microcontroller/__init__.h"
 #ifndef CALLBACK_CRITICAL_BEGIN
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
 #endif
 #ifndef CALLBACK_CRITICAL_END
 #define CALLBACK_CRITICAL_END (common_hal_mcu_enable_interrupts())
+#endif
+#endif
+
+// Callbacks are pushed onto a per-priority "inbox" stack by any number of
+// producers (interrupts and the main task) and taken off all at once by
+// background_callback_run_all, which reverses the stack to run them in the
+// order they were added.  Only the consumer walks or edits the list it took,
+// so the only shared operations are push and take-all.
+static background_callback_t *volatile callback_inbox[BACKGROUND_CALLBACK_NUM_PRIORITIES];
+
+// The callbacks of a taken list that haven't run yet, one list per priority
+// class, so that background_callback_gc_collect can see them.
+static background_callback_t *volatile callback_batch[BACKGROUND_CALLBACK_NUM_PRIORITIES];
+
+static int background_prevention_count;
+
+static const uint8_t callback_run_order[BACKGROUND_CALLBACK_NUM_PRIORITIES] = {
+    BACKGROUND_CALLBACK_PRIORITY_HIGH,
+    BACKGROUND_CALLBACK_PRIORITY_NORMAL,
+    BACKGROUND_CALLBACK_PRIORITY_LOW,
+};
+
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+#include "py/mphal.h"
+#ifndef BACKGROUND_CALLBACK_TICKS
+#define BACKGROUND_CALLBACK_TICKS() ((uint32_t)mp_hal_ticks_us())
+#endif
+#endif
+
+#if CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+
+// These are sequentially consistent so that an add that finds the callback
+// already queued is always followed by a run that sees the adder's writes.
+static inline bool callback_mark_queued(background_callback_t *cb) {
+    return __atomic_exchange_n(&cb->queued, 1, __ATOMIC_SEQ_CST) == 0;
+}
+
+static inline void callback_clear_queued(background_callback_t *cb) {
+    __atomic_store_n(&cb->queued, 0, __ATOMIC_SEQ_CST);
+}
+
+static inline void callback_push(background_callback_t *cb, size_t priority) {
+    background_callback_t *head = __atomic_load_n(&callback_inbox[priority], __ATOMIC_RELAXED);
+    do {
+        cb->next = head;
+    } while (!__atomic_compare_exchange_n(&callback_inbox[priority], &head, cb, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static inline background_callback_t *callback_take(size_t priority) {
+    return __atomic_exchange_n(&callback_inbox[priority], NULL, __ATOMIC_ACQUIRE);
+}
+
+static inline int callback_prevention_add(int delta) {
+    return __atomic_fetch_add(&background_prevention_count, delta, __ATOMIC_ACQ_REL);
+}
+
+#else
+
+static inline bool callback_mark_queued(background_callback_t *cb) {
+    CALLBACK_CRITICAL_BEGIN;
+    bool was_queued = cb->queued;
+    cb->queued = 1;
+    CALLBACK_CRITICAL_END;
+    return !was_queued;
+}
+
+static inline void callback_clear_queued(background_callback_t *cb) {
+    cb->queued = 0;
+}
+
+static inline void callback_push(background_callback_t *cb, size_t priority) {
+    CALLBACK_CRITICAL_BEGIN;
+    cb->next = (background_callback_t *)callback_inbox[priority];
+    callback_inbox[priority] = cb;
+    CALLBACK_CRITICAL_END;
+}
+
+static inline background_callback_t *callback_take(size_t priority) {
+    CALLBACK_CRITICAL_BEGIN;
+    background_callback_t *cb = (background_callback_t *)callback_inbox[priority];
+    callback_inbox[priority] = NULL;
+    CALLBACK_CRITICAL_END;
+    return cb;
+}
+
+static inline int callback_prevention_add(int delta) {
+    CALLBACK_CRITICAL_BEGIN;
+    int old = background_prevention_count;
+    background_prevention_count += delta;
+    CALLBACK_CRITICAL_END;
+    return old;
+}
+
 #endif
 
 MP_WEAK void PLACE_IN_ITCM(port_wake_main_task)(void) {
 }
 
 void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
-    CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
-        CALLBACK_CRITICAL_END;
+    if (!callback_mark_queued(cb)) {
         return;
     }
-    cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
-    }
-    if (!callback_head) {
-        callback_head = cb;
-    }
-    callback_tail = cb;
-    CALLBACK_CRITICAL_END;
+    #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+    cb->queued_at = BACKGROUND_CALLBACK_TICKS();
+    #endif
+    callback_push(cb, cb->priority);
 
     port_wake_main_task();
 }
 
 void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, background_callback_fun fun, void *data) {
+    background_callback_add_priority(cb, fun, data, BACKGROUND_CALLBACK_PRIORITY_NORMAL);
+}
+
+void PLACE_IN_ITCM(background_callback_add_priority)(background_callback_t * cb, background_callback_fun fun, void *data, background_callback_priority_t priority) {
     cb->fun = fun;
     cb->data = data;
+    cb->priority = priority;
     background_callback_add_core(cb);
 }
 
 inline bool background_callback_pending(void) {
-    return callback_head != NULL;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        if (callback_inbox[i] != NULL) {
+            return true;
+        }
+    }
+    return false;
 }
 
-static int background_prevention_count;
-
-void PLACE_IN_ITCM(background_callback_run_all)() {
-    port_background_task();
-    if (!background_callback_pending()) {
-        return;
-    }
-    CALLBACK_CRITICAL_BEGIN;
-    if (background_prevention_count) {
-        CALLBACK_CRITICAL_END;
-        return;
-    }
-    ++background_prevention_count;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
+// Take the whole inbox for a priority class, oldest callback first.
+static background_callback_t *callback_take_in_order(size_t priority) {
+    background_callback_t *cb = callback_take(priority);
+    background_callback_t *in_order = NULL;
     while (cb) {
         background_callback_t *next = cb->next;
-        cb->next = cb->prev = NULL;
+        cb->next = in_order;
+        in_order = cb;
+        cb = next;
+    }
+    return in_order;
+}
+
+static void PLACE_IN_ITCM(callback_run_batch)(size_t priority) {
+    callback_batch[priority] = callback_take_in_order(priority);
+    while (callback_batch[priority]) {
+        background_callback_t *cb = (background_callback_t *)callback_batch[priority];
+        callback_batch[priority] = cb->next;
+        cb->next = NULL;
         background_callback_fun fun = cb->fun;
         void *data = cb->data;
-        CALLBACK_CRITICAL_END;
-        // Leave the critical section in order to run the callback function
+        #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+        uint32_t latency = BACKGROUND_CALLBACK_TICKS() - cb->queued_at;
+        if (latency > cb->latency_max) {
+            cb->latency_max = latency;
+        }
+        cb->latency_total += latency;
+        cb->run_count += 1;
+        #endif
+        // From here on the callback may be queued again, even by itself.
+        callback_clear_queued(cb);
         if (fun) {
             fun(data);
         }
-        CALLBACK_CRITICAL_BEGIN;
-        cb = next;
+        // Don't make high priority work wait for the rest of this batch.
+        if (priority != BACKGROUND_CALLBACK_PRIORITY_HIGH
+            && callback_inbox[BACKGROUND_CALLBACK_PRIORITY_HIGH] != NULL) {
+            callback_run_batch(BACKGROUND_CALLBACK_PRIORITY_HIGH);
+        }
     }
-    --background_prevention_count;
-    CALLBACK_CRITICAL_END;
 }
 
-void background_callback_prevent() {
-    CALLBACK_CRITICAL_BEGIN;
-    ++background_prevention_count;
-    CALLBACK_CRITICAL_END;
+void PLACE_IN_ITCM(background_callback_run_all)(void) {
+    port_background_task();
+    if (!background_callback_pending()) {
+        return;
+    }
+    if (callback_prevention_add(1) != 0) {
+        callback_prevention_add(-1);
+        return;
+    }
+    // Each class is taken when its turn comes, so callbacks queued by a
+    // callback (including itself) run during the next call, not this one.
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        callback_run_batch(callback_run_order[i]);
+    }
+    callback_prevention_add(-1);
 }
 
-void background_callback_allow() {
-    CALLBACK_CRITICAL_BEGIN;
-    --background_prevention_count;
-    CALLBACK_CRITICAL_END;
+void background_callback_prevent(void) {
+    callback_prevention_add(1);
+}
+
+void background_callback_allow(void) {
+    callback_prevention_add(-1);
 }
 
 
 // Filter out queued callbacks if they are allocated on the heap.
-void background_callback_reset() {
-    background_callback_t *new_head = NULL;
-    background_callback_t **previous_next = &new_head;
-    background_callback_t *new_tail = NULL;
-    CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = NULL;
-        // Unlink any callbacks that are allocated on the python heap or if they
-        // reference data on the python heap. The python heap will be disappear
-        // soon after this.
-        if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
-            cb->prev = NULL; // Used to indicate a callback isn't queued.
-        } else {
-            // Set .next of the previous callback.
-            *previous_next = cb;
-            // Set our .next for the next callback.
-            previous_next = &cb->next;
-            // Set our prev to the last callback.
-            cb->prev = new_tail;
-            // Now we're the tail of the list.
-            new_tail = cb;
+void background_callback_reset(void) {
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        background_callback_t *cb = callback_take_in_order(i);
+        while (cb) {
+            background_callback_t *next = cb->next;
+            // Unlink any callbacks that are allocated on the python heap or if they
+            // reference data on the python heap. The python heap will be disappear
+            // soon after this.
+            if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
+                cb->next = NULL;
+                callback_clear_queued(cb);
+            } else {
+                // Requeue in the original order.
+                callback_push(cb, i);
+            }
+            cb = next;
         }
-        cb = next;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
     background_prevention_count = 0;
-    CALLBACK_CRITICAL_END;
 }
 
 void background_callback_gc_collect(void) {
     // We don't enter the callback critical section here.  We rely on
     // gc_collect_ptr _NOT_ entering background callbacks, so it is not
-    // possible for the list to be cleared.
+    // possible for the lists to be taken.
     //
-    // However, it is possible for the list to be extended.  We make the
+    // However, it is possible for an inbox to be extended.  We make the
     // minor assumption that no newly added callback is for a
     // collectable object.  That is, we only plug the hole where an
     // object becomes collectable AFTER it is added but before the
     // callback is run, not the hole where an object was ALREADY
     // collectable but adds a background task for itself.
     //
-    // It's necessary to traverse the whole list here, as the callbacks
+    // It's necessary to traverse the whole lists here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        for (background_callback_t *cb = (background_callback_t *)callback_inbox[i]; cb; cb = cb->next) {
+            gc_collect_ptr(cb->data);
+        }
+        for (background_callback_t *cb = (background_callback_t *)callback_batch[i]; cb; cb = cb->next) {
+            gc_collect_ptr(cb->data);
+        }
     }
 }
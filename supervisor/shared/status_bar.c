@@ -143,6 +143,7 @@ void supervisor_status_bar_resume(void) {
 void supervisor_status_bar_init(void) {
     status_bar_background_cb.fun = status_bar_background;
     status_bar_background_cb.data = NULL;
+    status_bar_background_cb.priority = BACKGROUND_CALLBACK_PRIORITY_LOW;
 
     shared_module_supervisor_status_bar_init(&shared_module_supervisor_status_bar_obj);
 }
@@ -0,0 +1,32 @@
+# test builtin pow() with 3 args where the modulus is a large odd number
+
+try:
+    print(pow(3, 4, 7))
+except NotImplementedError:
+    print("SKIP")
+    raise SystemExit
+
+# a Mersenne prime and a composite odd modulus
+p = (1 << 521) - 1
+m = p * 3 * ((1 << 127) - 1)
+for mod in (p, m, (1 << 64) + 13, (1 << 2048) - 159):
+    print(pow(2, mod - 1, mod) % 1000000007)
+    print(pow(3, 65537, mod) % 1000000007)
+    print(pow(mod - 1, 12345, mod) == mod - 1)
+    print(pow(mod + 5, 2, mod), pow(0, 10, mod), pow(7, 0, mod), pow(7, 1, mod))
+
+# Fermat's little theorem with a big prime
+print(pow(123456789123456789, p - 1, p))
+
+# negative base is reduced first
+print(pow(-2, 1001, p) == p - pow(2, 1001, p))
+print(pow(-12345678901234567890, 3, (1 << 100) + 1))
+
+# negative and even moduli take the generic path and must agree
+print(pow(5, 1000, -p) == pow(5, 1000, p) - p)
+print(pow(5, 1000, p + 1) == (5**1000) % (p + 1))
+
+# exponents spanning several digits, with high bits set
+e = (1 << 200) - 1
+print(pow(3, e, p) % 1000000007, pow(3, e + 2, p) % 1000000007)
+print(pow(3, 1 << 300, m) % 1000000007)
@@ -0,0 +1,96 @@
+# test that attribute accesses at the same call site see changes to classes
+# and instances (the VM may cache where attributes were last found)
+
+
+class A:
+    x = 1
+
+    def __init__(self):
+        self.y = 2
+
+    def f(self):
+        return "A.f"
+
+
+class B:
+    x = 10
+
+    def __init__(self):
+        self.y = 20
+
+    def f(self):
+        return "B.f"
+
+
+def get_x(c):
+    return c.x
+
+
+def get_y(o):
+    return o.y
+
+
+def call_f(o):
+    return o.f()
+
+
+def set_y(o, v):
+    o.y = v
+
+
+# the same site seeing different classes and instances
+a = A()
+b = B()
+for o in (a, b, a, b):
+    print(get_x(type(o)), get_y(o), call_f(o))
+
+# class attribute reassigned and deleted
+print(get_x(A))
+A.x = 3
+print(get_x(A))
+del A.x
+try:
+    get_x(A)
+except AttributeError:
+    print("AttributeError")
+A.x = 4
+print(get_x(A))
+
+# class attribute replaced by a staticmethod or classmethod
+A.x = staticmethod(lambda: "static")
+print(get_x(A)())
+A.x = classmethod(lambda cls: cls.__name__)
+print(get_x(A)())
+A.x = 5
+print(get_x(A))
+
+# instance member deleted and re-added, and members map grown
+print(get_y(a))
+del a.y
+try:
+    get_y(a)
+except AttributeError:
+    print("AttributeError")
+a.y = 6
+for i in range(20):
+    setattr(a, "z%d" % i, i)
+print(get_y(a))
+
+# stores to the same site on different instances
+a2 = A()
+for o in (a, a2, a, a2):
+    set_y(o, get_y(o) + 1)
+print(get_y(a), get_y(a2))
+
+# method shadowed by an instance member, then unshadowed
+print(call_f(a))
+a.f = lambda: "member"
+print(call_f(a))
+del a.f
+print(call_f(a))
+
+# method replaced in the class
+A.f = lambda self: "new A.f"
+print(call_f(a))
+A.f = staticmethod(lambda: "static f")
+print(call_f(a))
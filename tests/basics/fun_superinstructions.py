@@ -0,0 +1,87 @@
+# test opcode sequences that the compiler may fuse, and that the VM may
+# specialise once they have run with small int arguments
+
+
+class A:
+    def __init__(self, x):
+        self.x = x
+        self.y = []
+
+    def get(self):
+        return self.x
+
+    def add(self, v):
+        self.y.append(v)
+        self.x = self.x + v
+        return self.get()
+
+    def unbound(self):
+        del self
+        return self.x
+
+
+a = A(1)
+print(a.add(2), a.add(3), a.y)
+try:
+    a.unbound()
+except NameError:
+    print("NameError")
+
+
+# attribute access on the first argument of a plain function
+def f(o):
+    o.x += 1
+    return o.x
+
+
+print(f(a), f(a))
+
+
+# comparisons feeding conditional jumps, with small ints and other types
+def count(lo, hi, step):
+    n = 0
+    i = lo
+    while i < hi:
+        if i == 3:
+            n += 100
+        if i != 4:
+            n += 1
+        i += step
+    return n
+
+
+for _ in range(3):
+    print(count(0, 10, 1))
+print(count(0.0, 10.0, 1.5))
+print(count("", "aaaa", "a"))
+
+
+def compare(a, b):
+    return [a < b, a > b, a == b, a <= b, a >= b, a != b]
+
+
+# run each compare several times so it is specialised, then change types
+for _ in range(3):
+    print(compare(1, 2), compare(2, 2))
+print(compare(1, 2.5), compare("a", "b"), compare([1], [1]))
+
+
+# additions and subtractions that overflow small ints
+def arith(a, b):
+    c = a
+    c += b
+    d = a
+    d -= b
+    return a + b, a - b, c, d
+
+
+for _ in range(3):
+    print(arith(1, 2))
+print(arith(2**29, 2**29))
+print(arith(-(2**62), 2**62))
+print(arith(2**100, 1))
+print(arith(1.5, 1))
+try:
+    arith("a", "b")
+except TypeError:
+    print("TypeError")
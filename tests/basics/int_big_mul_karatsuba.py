@@ -0,0 +1,45 @@
+# test multiplication of big ints large enough to use Karatsuba's method
+
+# simple deterministic generator of big ints with a given number of bits
+seed = 12345
+
+
+def rand_bits(n):
+    global seed
+    x = 0
+    for _ in range((n + 29) // 30):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        x = (x << 30) | (seed >> 1)
+    return x >> (x.bit_length() - n) if x.bit_length() > n else x
+
+
+# balanced operands either side of typical thresholds
+for bits in (255, 256, 511, 512, 1000, 1024, 2047, 2048, 4096, 8000):
+    a = rand_bits(bits)
+    b = rand_bits(bits)
+    print(bits, (a * b) % 1000000007, (a * b).bit_length())
+    print(a * a == a**2, (a * b) // b == a)
+
+# unbalanced operands
+for abits, bbits in ((4096, 600), (8000, 1024), (3000, 2100), (1024, 300)):
+    a = rand_bits(abits)
+    b = rand_bits(bbits)
+    print(abits, bbits, (a * b) % 1000000007, (b * a) % 1000000007)
+
+# operands with long runs of zero and all-ones digits
+for bits in (1024, 3000):
+    a = (1 << bits) - 1
+    b = (1 << bits) + 1
+    print(hex(a * a)[-20:], a * b == (1 << (2 * bits)) - 1)
+    c = (1 << bits) | 1
+    print(c * c == (1 << (2 * bits)) + (1 << (bits + 1)) + 1)
+
+# signs
+a = rand_bits(2000)
+b = rand_bits(2000)
+print((-a * b) % 1000000007, (a * -b) == -(a * b), (-a) * (-b) == a * b)
+
+# full value of one big product
+a = rand_bits(1500)
+b = rand_bits(1500)
+print(hex(a * b))
@@ -0,0 +1,36 @@
+# test substring search on haystacks long enough to use a skip table
+
+h = "".join("line %d: key=value%d;" % (i, i * 7) for i in range(200))
+b = bytes(h, "ascii")
+
+for needle in ("line 199:", "key=value7;", "value1393", "notfound", "e", ";", "=v", "line 1"):
+    print(needle, h.find(needle), h.rfind(needle), h.count(needle), needle in h)
+    bn = bytes(needle, "ascii")
+    print(b.find(bn), b.rfind(bn), b.count(bn), bn in b)
+
+# start/end arguments
+print(h.find("line", 100), h.find("line", 100, 110), h.rfind("line", 0, 200), h.rfind("line", 5000))
+print(h.count("line", 50, 2000), h.count("key", 3000, 10))
+
+# split, rsplit and replace with multi-byte separators
+print(len(h.split("; ")), len(h.split(";line")), h.split(";line", 3)[:3])
+print(h.rsplit(";line", 2)[1:], len(h.rsplit("key=", 10)))
+print(len(h.replace("key=", "K")), h.replace("value", "v", 4)[:80])
+
+# overlapping and repetitive patterns, where a naive skip would be wrong
+s = "ab" * 100 + "abc" + "ab" * 100
+print(s.find("ababc"), s.rfind("babab"), s.count("abab"), s.find("abcab"))
+s = "a" * 300
+print(s.find("a" * 40), s.rfind("a" * 40), s.count("aaa"), s.find("a" * 40 + "b"))
+print(("x" * 100 + "y").find("x" * 50 + "y"), ("y" + "x" * 100).rfind("y" + "x" * 50))
+
+# all byte values, and needles longer than 255 bytes
+b = bytes(range(256)) * 3
+print(b.find(bytes(range(250, 256)) + bytes(range(10))), b.rfind(b"\x00\x01"), b.count(b"\xff\x00"))
+n = bytes(range(256)) + b"\x00"
+print(b.find(n), b.rfind(n), b.find(n + b"\x02"), b.count(n))
+print(bytearray(b).find(b"\x10\x11\x12"), bytearray(b).rfind(b"\x10\x11\x12"))
+
+# unicode
+u = "äöü" * 50 + "€x€" + "äöü" * 50
+print(u.find("ü€x"), u.rfind("öüä"), u.count("öü"), u.split("€x€")[1][:6])
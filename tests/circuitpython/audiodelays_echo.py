@@ -0,0 +1,43 @@
+# Checks how Echo reads its input: the dry sample, the echoes that keep coming
+# after a sample that doesn't loop has finished, looping, and format checks.
+import array
+from audiocore import RawSample, get_buffer
+from audiodelays import Echo
+
+# A click at the start of 16 samples of silence.
+click = RawSample(array.array("h", [16384] + [0] * 15), sample_rate=8000)
+
+
+def show(effect, buffers):
+    for _ in range(buffers):
+        result, data = get_buffer(effect)
+        print(result, effect.playing, [(i, v) for i, v in enumerate(data) if v])
+
+
+effect = Echo(max_delay_ms=50, delay_ms=25, decay=0.5, mix=0.5, buffer_size=128)
+print(effect.playing)
+effect.play(click)
+print(effect.playing)
+show(effect, 8)
+
+# A looping sample keeps playing until it is stopped, and then only its echoes are left.
+effect.play(click, loop=True)
+show(effect, 2)
+effect.stop()
+show(effect, 4)
+
+# Without mix only the dry sample comes through.
+effect.mix = 0.0
+effect.play(click)
+show(effect, 2)
+
+for kwargs in (
+    {"sample_rate": 16000},
+    {"channel_count": 2},
+    {"bits_per_sample": 8},
+    {"samples_signed": False},
+):
+    try:
+        Echo(**kwargs).play(click)
+    except ValueError as e:
+        print(e)
@@ -0,0 +1,100 @@
+# Checks that Distortion stays close to its defining formulas, whether it
+# shapes samples directly or from its lookup table.
+import array
+import math
+from audiocore import RawSample, get_buffer
+from audiofilters import Distortion, DistortionMode
+
+ramp = array.array("h", range(-32768, 32768, 97))
+
+
+def db_to_linear(value):
+    return math.exp(value * 0.11512925464970228)
+
+
+def reference(mode, drive, pre_gain, post_gain, soft_clip, mix, sample):
+    word = int(sample * db_to_linear(pre_gain))
+    if mode == DistortionMode.LOFI:
+        word &= ~((1 << round(drive * 14)) - 1)
+        if not soft_clip:
+            word = int(word * db_to_linear(post_gain))
+    if mode != DistortionMode.LOFI or soft_clip:
+        x = word / 32768
+        if mode == DistortionMode.CLIP:
+            x = math.copysign(math.pow(abs(x), 1.0001 - drive), word)
+        elif mode == DistortionMode.OVERDRIVE:
+            x *= 0.686306
+            z = 1 + math.exp(math.sqrt(abs(x)) * -0.75)
+            x = (math.exp(x) - math.exp(-x * z)) / (math.exp(x) + math.exp(-x))
+        elif mode == DistortionMode.WAVESHAPE:
+            k = 2 * drive / (1.0001 - drive)
+            x = (1 + k) * x / (1 + k * abs(x))
+        x *= db_to_linear(post_gain)
+        if soft_clip:
+            x = 1 - math.exp(-x) if x > 0 else -1 + math.exp(x)
+        word = int(x * 32767)
+    if not soft_clip:
+        word = min(max(word, -32767), 32767)
+    return int(sample * (1 - mix) + word * mix)
+
+
+position = 0
+
+
+def max_error(effect, buffers, *settings):
+    global position
+    error = 0
+    for _ in range(buffers):
+        for value in get_buffer(effect)[1]:
+            sample = ramp[position % len(ramp)]
+            error = max(error, abs(value - reference(*settings, sample)))
+            position += 1
+    return error
+
+
+def check(mode, drive, pre_gain, soft_clip, post_gain=0, mix=1.0, tolerance=16):
+    effect = Distortion(
+        mode=mode,
+        drive=drive,
+        pre_gain=pre_gain,
+        post_gain=post_gain,
+        soft_clip=soft_clip,
+        mix=mix,
+        buffer_size=1024,
+    )
+    effect.play(RawSample(ramp, sample_rate=8000), loop=True)
+    global position
+    position = 0
+    error = max_error(effect, 4, mode, drive, pre_gain, post_gain, soft_clip, mix)
+    print(mode, drive, pre_gain, soft_clip, error <= tolerance)
+    return effect
+
+
+for mode in (
+    DistortionMode.CLIP,
+    DistortionMode.LOFI,
+    DistortionMode.OVERDRIVE,
+    DistortionMode.WAVESHAPE,
+):
+    for drive in (0.0, 0.5, 0.9):
+        for pre_gain in (-12, 0, 24):
+            for soft_clip in (False, True):
+                # The formulas cut an attenuated sample down to a whole number before
+                # shaping it, which makes steps in the steep low end of the heavier
+                # curves; the lookup table interpolates across them.
+                tolerance = 64 if drive > 0.5 and pre_gain < 0 else 16
+                check(mode, drive, pre_gain, soft_clip, tolerance=tolerance)
+
+# mixed with the dry signal, and with post-gain
+check(DistortionMode.OVERDRIVE, 0.0, 6, False, post_gain=-6, mix=0.5)
+check(DistortionMode.WAVESHAPE, 0.5, 0, True, post_gain=12, mix=0.25)
+
+# the steepest curves are approximated less closely
+check(DistortionMode.WAVESHAPE, 0.99, -12, False, tolerance=128)
+
+# changing a setting takes effect from the next buffer
+effect = check(DistortionMode.CLIP, 0.0, 12, False)
+effect.drive = 0.7
+get_buffer(effect)
+position += 512
+print(max_error(effect, 4, DistortionMode.CLIP, 0.7, 12, 0, False, 1.0) <= 16)
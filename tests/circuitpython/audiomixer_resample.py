@@ -0,0 +1,46 @@
+import array
+from audiocore import get_buffer, RawSample
+from audiomixer import Mixer
+
+# Stereo ramp on the left, constant on the right, upsampled 2x.
+ramp = array.array("h", [0] * 200)
+for i in range(100):
+    ramp[2 * i] = i * 100
+    ramp[2 * i + 1] = -5000
+for quality in range(3):
+    mixer = Mixer(
+        voice_count=2,
+        sample_rate=16000,
+        channel_count=2,
+        buffer_size=256,
+        resample_quality=quality,
+    )
+    mixer.voice[0].play(RawSample(ramp, sample_rate=8000, channel_count=2))
+    samples = get_buffer(mixer)[1]
+    print(quality, list(samples[:12]), list(samples[-4:]))
+
+# Unsigned 8 bit sample, downsampled 2x and looped until told to stop.
+saw = array.array("B", [128 + i * 5 for i in range(20)])
+mixer = Mixer(
+    voice_count=1,
+    sample_rate=11025,
+    channel_count=1,
+    bits_per_sample=8,
+    samples_signed=False,
+    buffer_size=128,
+    resample_quality=0,
+)
+mixer.voice[0].play(RawSample(saw, sample_rate=22050), loop=True)
+for i in range(2):
+    print(list(get_buffer(mixer)[1])[:24])
+mixer.voice[0].loop = False
+buffers = 0
+while mixer.playing:
+    get_buffer(mixer)
+    buffers += 1
+print("stopped after", buffers)
+
+try:
+    Mixer(resample_quality=3)
+except ValueError as e:
+    print(e)
@@ -0,0 +1,71 @@
+try:
+    MemoryFramebuffer
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+import displayio
+import framebufferio
+import gc
+import vectorio
+
+WIDTH = 24
+HEIGHT = 10
+
+COLORS = (0x000000, 0xFF0000, 0x00FF00, 0x0000FF)
+# The same colors in RGB565.
+CHARS = {0x0000: ".", 0xF800: "#", 0x07E0: "+", 0x001F: "*"}
+
+
+def show(framebuffer):
+    pixels = memoryview(framebuffer).cast("H")
+    for y in range(HEIGHT):
+        print("".join(CHARS[pixels[y * WIDTH + x]] for x in range(WIDTH)))
+    print()
+
+
+framebuffer = MemoryFramebuffer(WIDTH, HEIGHT)
+display = framebufferio.FramebufferDisplay(framebuffer, auto_refresh=False)
+print(display.width, display.height)
+
+palette = displayio.Palette(4)
+for i, color in enumerate(COLORS):
+    palette[i] = color
+
+# Two 3x3 tiles, a diagonal and a border.
+bitmap = displayio.Bitmap(6, 3, 4)
+for i in range(3):
+    bitmap[i, i] = 1
+    bitmap[3 + i, 0] = bitmap[3 + i, 2] = bitmap[3, i] = bitmap[5, i] = 2
+grid = displayio.TileGrid(bitmap, pixel_shader=palette, width=4, height=2, tile_width=3, tile_height=3, x=1, y=1)
+grid[1, 0] = 1
+grid[2, 1] = 1
+
+group = displayio.Group()
+group.append(grid)
+group.append(vectorio.Rectangle(pixel_shader=palette, width=5, height=4, x=16, y=2, color_index=3))
+display.root_group = group
+del group, bitmap, palette
+gc.collect()
+
+display.refresh()
+show(framebuffer)
+
+# Only the areas that changed are redrawn.
+grid.x = 4
+grid[0, 1] = 1
+display.root_group[1].x = 18
+display.refresh()
+show(framebuffer)
+
+grid.hidden = True
+display.refresh()
+show(framebuffer)
+
+display.root_group = None
+display.refresh()
+show(framebuffer)
+
+displayio.release_displays()
+framebufferio.FramebufferDisplay(framebuffer, auto_refresh=False)
+print("released")
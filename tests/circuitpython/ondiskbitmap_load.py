@@ -0,0 +1,122 @@
+# Checks OnDiskBitmap.load() on BMP files written to a FAT filesystem in RAM:
+# whole images, regions, step and invalid arguments.
+import os
+import struct
+import displayio
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMBlockDevice(50)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+
+# Writes a BMP with a 40 byte header. Rows are given top to bottom.
+def write_bmp(name, bits_per_pixel, rows, colors=()):
+    width = len(rows[0])
+    stride = (width * bits_per_pixel + 31) // 32 * 4
+    data = bytearray()
+    for row in reversed(rows):
+        line = bytearray()
+        for value in row:
+            if bits_per_pixel == 8:
+                line.append(value)
+            else:
+                line += struct.pack("<I", value)[:3]
+        data += line + bytes(stride - len(line))
+    data_offset = 14 + 40 + 4 * len(colors)
+    # Headers shorter than 138 bytes are rejected, so pad the pixel data.
+    data += bytes(max(0, 138 - data_offset - len(data)))
+    with open(name, "wb") as f:
+        f.write(b"BM" + struct.pack("<IHHI", data_offset + len(data), 0, 0, data_offset))
+        f.write(
+            struct.pack(
+                "<IiiHHIIiiII",
+                40,
+                width,
+                len(rows),
+                1,
+                bits_per_pixel,
+                0,
+                len(data),
+                0,
+                0,
+                len(colors),
+                0,
+            )
+        )
+        for color in colors:
+            f.write(struct.pack("<I", color))
+        f.write(data)
+
+
+def show(bitmap, fmt="{:x}"):
+    print(bitmap.width, bitmap.height)
+    for y in range(bitmap.height):
+        print(" ".join(fmt.format(bitmap[x, y]) for x in range(bitmap.width)))
+
+
+# An indexed image keeps its palette indices.
+write_bmp(
+    "/ramdisk/indexed.bmp",
+    8,
+    [[(x + 5 * y) % 16 for x in range(5)] for y in range(4)],
+    [i * 0x111111 for i in range(16)],
+)
+odb = displayio.OnDiskBitmap("/ramdisk/indexed.bmp")
+print(odb.width, odb.height, type(odb.pixel_shader).__name__)
+show(odb.load())
+show(odb.load(1, 1, 4, 3))
+show(odb.load(step=2))
+show(odb.load(1, 1, step=3))
+
+# Other images are loaded as RGB888. The coverage build caches 64 bytes of the file, so
+# these 32 byte rows are read two at a time.
+write_bmp("/ramdisk/rgb.bmp", 24, [[y << 16 | x << 8 | 0x80 for x in range(10)] for y in range(7)])
+odb = displayio.OnDiskBitmap(open("/ramdisk/rgb.bmp", "rb"))
+print(odb.width, odb.height, type(odb.pixel_shader).__name__)
+show(odb.load(), "{:06x}")
+show(odb.load(2, 3, 9, 7, step=2), "{:06x}")
+show(odb.load(9, 6), "{:06x}")
+
+for args, kwargs in (
+    ((10,), {}),
+    ((-1,), {}),
+    ((0, 7), {}),
+    ((3, 0, 3), {}),
+    ((0, 0, 11), {}),
+    ((0, 2, None, 1), {}),
+    ((0, 0, None, 8), {}),
+    ((), {"step": 0}),
+):
+    try:
+        odb.load(*args, **kwargs)
+    except ValueError as e:
+        print(e)
+
+try:
+    displayio.OnDiskBitmap(123)
+except TypeError as e:
+    print(e)
+
+os.umount("/ramdisk")
@@ -0,0 +1,30 @@
+import array
+from audiocore import get_buffer
+import synthio
+
+saw = array.array("h", [-30000 + 60000 * i // 64 for i in range(64)])
+linear = synthio.Wavetable(saw)
+cubic = synthio.Wavetable(saw, cubic=True)
+print(linear.cubic, cubic.cubic)
+
+# The first copy is visible as a read-only array
+table = memoryview(linear)
+print(len(table), table[0], min(table), max(table))
+try:
+    memoryview(linear)[0] = 0
+except TypeError as e:
+    print(type(e).__name__)
+
+# Low and high notes, the next to highest only plays a sine, and the highest is
+# above the Nyquist frequency
+for frequency in (220, 4000, 13000, 30000):
+    for wave in (saw, linear, cubic):
+        synth = synthio.Synthesizer(sample_rate=48000)
+        synth.press(synthio.Note(frequency, waveform=wave))
+        samples = get_buffer(synth)[1]
+        print(frequency, list(samples[100:106]), max(samples))
+
+# The default waveform of a Synthesizer can be a Wavetable too
+synth = synthio.Synthesizer(sample_rate=48000, waveform=linear)
+synth.press(96)
+print(list(get_buffer(synth)[1][:6]))
@@ -0,0 +1,55 @@
+# cmdline: -X emit=native-all
+# test compiling every function natively, falling back to bytecode per function
+
+
+def add(a, b):
+    return a + b
+
+
+def reraise(f):
+    try:
+        return f()
+    except ValueError:
+        raise
+
+
+class A:
+    def scale(self, x):
+        return [i * x for i in range(3)]
+
+
+def gen(n):
+    yield from range(n)
+
+
+print(add(1, 2), A().scale(2), list(gen(3)), (lambda x: x + 1)(1))
+try:
+    reraise(lambda: int("x"))
+except ValueError:
+    print("reraised")
+
+
+# native functions must behave like the bytecode they replace
+import io, sys
+
+
+def unbound():
+    if False:
+        x = 1
+    return x
+
+
+def fail():
+    raise ValueError
+
+
+try:
+    unbound()
+except NameError:
+    print("NameError")
+try:
+    fail()
+except ValueError as e:
+    buf = io.StringIO()
+    sys.print_exception(e, buf)
+    print(buf.getvalue().splitlines()[2].split(", ")[1:])
@@ -0,0 +1,22 @@
+import bench
+import gc
+
+# Number of single-block holes left scattered through the heap.  Each
+# allocation below is too big for a hole, so the cost of finding free space
+# shows how the allocator scales with the size of a fragmented heap.
+N = 4000
+
+
+def test(num):
+    live = [None] * N
+    dead = [None] * N
+    for i in range(N):
+        live[i] = i + 0.5
+        dead[i] = i + 0.25
+    dead = None
+    gc.collect()
+    for i in iter(range(num // 200)):
+        bytearray(256)
+
+
+bench.run(test)
@@ -0,0 +1,25 @@
+# test garbage collection pause statistics
+
+import gc
+
+try:
+    gc.pause_info
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+keep = [[i, str(i)] for i in range(5000)]
+gc.collect()
+max_pause, last_pause, count = gc.pause_info()
+print(count > 0)
+print(0 <= last_pause <= max_pause)
+
+# each collection is counted, and the longest one is kept
+gc.collect()
+gc.collect()
+max2, last2, count2 = gc.pause_info()
+print(count2 - count)
+print(max2 >= max_pause and max2 >= last2)
+
+# everything reachable survived
+print(all(keep[i][1] == str(i) for i in range(5000)))
@@ -0,0 +1,61 @@
+# test native add, subtract and compare, which have a fast path for small ints
+
+
+@micropython.native
+def ops(a, b):
+    return a + b, a - b, a < b, a > b, a == b, a <= b, a >= b, a != b
+
+
+@micropython.native
+def aug(a, b):
+    a += b
+    c = a
+    c -= b
+    return a, c
+
+
+@micropython.native
+def const(a):
+    return a + 1, a - 1, 1 - a, a < 0, 0 <= a
+
+
+@micropython.native
+def loop(n):
+    s = 0
+    for i in range(n):
+        s += i
+    for i in range(n, 0, -3):
+        s -= i
+    return s
+
+
+# values around the small-int limits of 32 and 64-bit targets, plus non-ints
+vals = [0, 1, -1, 7, -7]
+for bits in (30, 62):
+    vals.extend((2**bits - 1, 2**bits, -(2**bits), -(2**bits) - 1))
+vals.extend((2**70, True, "s"))
+
+for a in vals:
+    for b in vals:
+        try:
+            print(a, b, ops(a, b), aug(a, b))
+        except TypeError:
+            print(a, b, "TypeError")
+    try:
+        print(const(a))
+    except TypeError:
+        print("TypeError")
+
+print(loop(0), loop(10), loop(1000))
+
+
+
+# in-place add on a list must still extend it
+@micropython.native
+def extend(l):
+    l += [2]
+
+
+l = [1]
+extend(l)
+print(l)
@@ -0,0 +1,49 @@
+# This tests audiomixer throughput when voices play samples recorded at other
+# rates than the mixer's, at each resample_quality.
+
+try:
+    import array
+    from audiocore import get_buffer, RawSample
+    from audiomixer import Mixer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test(buffers, quality):
+    mixer = Mixer(
+        voice_count=3,
+        sample_rate=48000,
+        channel_count=2,
+        buffer_size=4096,
+        resample_quality=quality,
+    )
+    wave = array.array("h", [(i * 997) % 65536 - 32768 for i in range(2048)])
+    mixer.voice[0].play(RawSample(wave, sample_rate=22050, channel_count=2), loop=True)
+    mixer.voice[1].play(RawSample(wave, sample_rate=44100, channel_count=2), loop=True)
+    mixer.voice[2].play(RawSample(wave, sample_rate=16000, channel_count=2), loop=True)
+    for _ in range(buffers):
+        get_buffer(mixer)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1,),
+    (1000, 10): (20,),
+    (5000, 10): (100,),
+}
+
+
+def bm_setup(params):
+    (buffers,) = params
+
+    def run():
+        for quality in range(3):
+            test(buffers, quality)
+
+    def result():
+        return buffers * 3 * 1024 * 3, None
+
+    return run, result
@@ -0,0 +1,43 @@
+# This tests multiplication of big ints, from a few hundred to several
+# thousand bits, where the choice of multiplication algorithm dominates.
+
+
+def make(nbits, seed):
+    x = 1
+    while x.bit_length() < nbits:
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        x = (x << 31) | seed
+    return x >> (x.bit_length() - nbits)
+
+
+def test(a, b, n):
+    acc = 0
+    for _ in range(n):
+        acc ^= a * b
+        acc ^= a * a
+    return acc
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (256, 20),
+    (1000, 10): (1024, 200),
+    (5000, 10): (4096, 40),
+}
+
+
+def bm_setup(params):
+    nbits, nloop = params
+    a = make(nbits, 1)
+    b = make(nbits, 2)
+    state = [None]
+
+    def run():
+        state[0] = test(a, b, nloop)
+
+    def result():
+        return nbits * nloop // 100, state[0] % 1000000007
+
+    return run, result
@@ -0,0 +1,43 @@
+# This tests 3-argument pow() with big odd moduli, as used for RSA-style
+# modular exponentiation.
+
+
+def make(nbits, seed):
+    x = 1
+    while x.bit_length() < nbits:
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        x = (x << 31) | seed
+    return x >> (x.bit_length() - nbits)
+
+
+def test(base, exp, mod, n):
+    acc = 0
+    for i in range(n):
+        acc ^= pow(base + i, exp, mod)
+    return acc
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (256, 1),
+    (1000, 10): (1024, 2),
+    (5000, 10): (2048, 2),
+}
+
+
+def bm_setup(params):
+    nbits, nloop = params
+    base = make(nbits, 1)
+    exp = make(nbits, 2)
+    mod = make(nbits, 3) | 1
+    state = [None]
+
+    def run():
+        state[0] = test(base, exp, mod, nloop)
+
+    def result():
+        return nbits * nloop // 100, state[0] % 1000000007
+
+    return run, result
@@ -0,0 +1,41 @@
+# This tests qstr_find_strn() speed when the string being searched for has
+# already been interned, so lookups must find it among many other qstrs.
+
+
+class C:
+    pass
+
+
+def test(obj, names, n):
+    total = 0
+    for _ in range(n):
+        for name in names:
+            total += getattr(obj, name)
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (50, 4),
+    (1000, 10): (500, 4),
+    (5000, 10): (2000, 8),
+}
+
+
+def bm_setup(params):
+    nnames, nloop = params
+    obj = C()
+    names = ["attr_%d" % i for i in range(nnames)]
+    for i, name in enumerate(names):
+        setattr(obj, name, i)
+    state = [None]
+
+    def run():
+        state[0] = test(obj, names, nloop)
+
+    def result():
+        return nnames * nloop // 100, state[0]
+
+    return run, result
@@ -0,0 +1,46 @@
+# This tests substring search (find, in, count, split, replace) over
+# multi-kilobyte haystacks, like HTTP responses and log buffers.
+
+
+def test(text, n):
+    total = 0
+    for _ in range(n):
+        total += text.find("Content-Length: 4096")
+        total += text.rfind("X-Request-Id:")
+        total += ("session=expired" in text) + ("Set-Cookie: id=" in text)
+        total += text.count("\r\n")
+        total += len(text.split("\r\n\r\n"))
+        total += len(text.replace("HTTP/1.1", "HTTP/1.0"))
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (2, 10),
+    (1000, 10): (40, 10),
+    (5000, 10): (200, 10),
+}
+
+
+def bm_setup(params):
+    nresp, nloop = params
+    parts = []
+    for i in range(nresp):
+        parts.append(
+            "HTTP/1.1 200 OK\r\nServer: test/%d\r\nContent-Type: text/html\r\n"
+            "Set-Cookie: id=%d; Path=/\r\n\r\n<html><body>%s</body></html>\r\n\r\n"
+            % (i, i * 31, "lorem ipsum dolor sit amet " * 4)
+        )
+    parts.append("HTTP/1.1 200 OK\r\nX-Request-Id: 42\r\nContent-Length: 4096\r\n\r\n")
+    text = "".join(parts)
+    state = [None]
+
+    def run():
+        state[0] = test(text, nloop)
+
+    def result():
+        return nresp * nloop, state[0]
+
+    return run, result
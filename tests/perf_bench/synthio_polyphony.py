@@ -0,0 +1,55 @@
+# This tests synthio throughput with 1 to 12 sounding voices, spread over the
+# attack, sustain and release stages and with some of them filtered or panned.
+# The score is in voice-samples, so dividing the rate by the sample rate gives
+# how many voices one CPU can keep up with.
+
+try:
+    import array
+    import audiocore
+    import synthio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test(buffers, voices):
+    synth = synthio.Synthesizer(sample_rate=48000, channel_count=2)
+    envelope = synthio.Envelope(attack_time=0.05, decay_time=0.1, release_time=0.2, sustain_level=0.7)
+    lpf = synth.low_pass_filter(2000)
+    notes = []
+    for i in range(voices):
+        note = synthio.Note(
+            synthio.midi_to_hz(48 + 5 * i),
+            envelope=envelope,
+            panning=(i % 3 - 1) / 2,
+            filter=lpf if i % 4 == 0 else None,
+        )
+        notes.append(note)
+    synth.press(notes)
+    for b in range(buffers):
+        if b == buffers // 2:
+            synth.release(notes[::2])
+        audiocore.get_buffer(synth)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1, (1, 4)),
+    (1000, 10): (10, (1, 4, 8, 12)),
+    (5000, 10): (50, (1, 4, 8, 12)),
+}
+
+
+def bm_setup(params):
+    buffers, voice_counts = params
+
+    def run():
+        for voices in voice_counts:
+            test(buffers, voices)
+
+    def result():
+        return buffers * sum(voice_counts) * 256, None
+
+    return run, result
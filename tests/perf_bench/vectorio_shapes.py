@@ -0,0 +1,65 @@
+# This tests vectorio throughput when circles, rectangles and polygons move
+# across a 16 bpp display, so every refresh fills their old and new areas. It
+# needs a framebuffer in memory, which only the unix coverage build provides.
+
+try:
+    MemoryFramebuffer
+    import displayio
+    import framebufferio
+    import vectorio
+except (NameError, ImportError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 160
+HEIGHT = 120
+
+
+def test(frames, shapes):
+    displayio.release_displays()
+    display = framebufferio.FramebufferDisplay(MemoryFramebuffer(WIDTH, HEIGHT), auto_refresh=False)
+    palette = displayio.Palette(4)
+    for i, color in enumerate((0x000000, 0xFF0000, 0x00FF00, 0x0000FF)):
+        palette[i] = color
+    group = displayio.Group()
+    for i in range(shapes):
+        kind = i % 3
+        if kind == 0:
+            shape = vectorio.Circle(pixel_shader=palette, radius=12)
+        elif kind == 1:
+            shape = vectorio.Rectangle(pixel_shader=palette, width=30, height=18)
+        else:
+            # A concave arrow with two spans on some rows.
+            points = [(0, 0), (24, 12), (0, 24), (8, 12)]
+            shape = vectorio.Polygon(pixel_shader=palette, points=points)
+        shape.color_index = 1 + kind
+        group.append(shape)
+    display.root_group = group
+    for frame in range(frames):
+        for i, shape in enumerate(group):
+            shape.x = (i * 37 + frame * 3) % (WIDTH - 24)
+            shape.y = (i * 23 + frame * (1 + i % 3)) % (HEIGHT - 24)
+        display.refresh()
+    displayio.release_displays()
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (2, 3),
+    (1000, 10): (20, 12),
+    (5000, 10): (100, 12),
+}
+
+
+def bm_setup(params):
+    frames, shapes = params
+
+    def run():
+        test(frames, shapes)
+
+    def result():
+        return frames * shapes, None
+
+    return run, result
@@ -715,6 +715,8 @@ def run_tests(pyb, tests, args, result_dir, num_threads=1):
 
     # Some tests are known to fail with native emitter
     # Remove them from the below when they work
+    # (native-all keeps each function the native emitter can't compile
+    # faithfully as bytecode, so it must pass all of them)
     if args.emit == "native":
         skip_tests.add("basics/gen_yield_from_close.py")  # require raise_varargs
         skip_tests.update(
@@ -727,6 +729,7 @@ def run_tests(pyb, tests, args, result_dir, num_threads=1):
         skip_tests.add("basics/del_deref.py")  # requires checking for unbound local
         skip_tests.add("basics/del_local.py")  # requires checking for unbound local
         skip_tests.add("basics/exception_chain.py")  # raise from is not supported
+        skip_tests.add("basics/fun_superinstructions.py")  # requires checking for unbound local
         skip_tests.add("basics/scope_implicit.py")  # requires checking for unbound local
         skip_tests.add("basics/sys_tracebacklimit.py")  # requires traceback info
         skip_tests.add("basics/try_finally_return2.py")  # requires raise_varargs
@@ -781,7 +784,7 @@ def run_tests(pyb, tests, args, result_dir, num_threads=1):
         is_native = (
             test_name.startswith("native_")
             or test_name.startswith("viper_")
-            or args.emit == "native"
+            or args.emit in ("native", "native-all")
         )
         is_endian = test_name.endswith("_endian")
         is_int_big = test_name.startswith("int_big") or test_name.endswith("_intbig")
@@ -1013,7 +1016,9 @@ the last matching regex is used:
         "--list-tests", action="store_true", help="list tests instead of running them"
     )
     cmd_parser.add_argument(
-        "--emit", default="bytecode", help="MicroPython emitter to use (bytecode or native)"
+        "--emit",
+        default="bytecode",
+        help="MicroPython emitter to use (bytecode, native or native-all)",
     )
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
     cmd_parser.add_argument(
@@ -202,10 +202,14 @@ _displayio_color_t blinka_colors[7] = {{
     }},
 }};
 
+uint32_t blinka_native_colors[7];
+
 displayio_palette_t blinka_palette = {{
     .base = {{.type = &displayio_palette_type }},
     .colors = blinka_colors,
+    .native_colors = blinka_native_colors,
     .color_count = 7,
+    .transparent_count = 1,
     .needs_refresh = false
 }};
 
@@ -251,10 +255,14 @@ _displayio_color_t terminal_colors[2] = {
     },
 };
 
+uint32_t terminal_native_colors[2];
+
 displayio_palette_t supervisor_terminal_color = {
     .base = {.type = &displayio_palette_type },
     .colors = terminal_colors,
+    .native_colors = terminal_native_colors,
     .color_count = 2,
+    .transparent_count = 0,
     .needs_refresh = false
 };
 """
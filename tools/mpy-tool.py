@@ -1509,6 +1509,14 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
         qstr_content += config.MICROPY_QSTR_BYTES_IN_LEN
         qstr_content += len(qbytes) + 1  # include NUL
     print("};")
+    if config.MICROPY_QSTR_HASH_INDEX:
+        qstr_index = qstrutil.make_hash_index([qbytes for _, _, _, qbytes in new])
+        print()
+        print("const qstr_index_t mp_qstr_frozen_const_index[] = {")
+        for i in range(0, len(qstr_index), 16):
+            print("    %s," % ", ".join(str(x) for x in qstr_index[i : i + 16]))
+            qstr_content += 2 * len(qstr_index[i : i + 16])
+        print("};")
     print()
     print("extern const qstr_pool_t mp_qstr_const_pool;")
     print("const qstr_pool_t mp_qstr_frozen_const_pool = {")
@@ -1520,6 +1528,9 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
     if config.MICROPY_QSTR_BYTES_IN_HASH:
         print("    (qstr_hash_t *)mp_qstr_frozen_const_hashes,")
     print("    (qstr_len_t *)mp_qstr_frozen_const_lengths,")
+    if config.MICROPY_QSTR_HASH_INDEX:
+        print("    (qstr_index_t *)mp_qstr_frozen_const_index,")
+        print("    %u, // index mask" % (len(qstr_index) - 1))
     print("    {")
     for _, _, qstr, qbytes in new:
         print('        "%s",' % qstrutil.escape_bytes(qstr, qbytes))
@@ -1817,9 +1828,11 @@ def main():
         firmware_qstr_idents = set(qstrutil.static_qstr_list_ident) | set(extra_qstrs.keys())
         config.MICROPY_QSTR_BYTES_IN_LEN = int(qcfgs["BYTES_IN_LEN"])
         config.MICROPY_QSTR_BYTES_IN_HASH = int(qcfgs["BYTES_IN_HASH"])
+        config.MICROPY_QSTR_HASH_INDEX = int(qcfgs.get("HASH_INDEX", 0))
     else:
         config.MICROPY_QSTR_BYTES_IN_LEN = 1
         config.MICROPY_QSTR_BYTES_IN_HASH = 1
+        config.MICROPY_QSTR_HASH_INDEX = 0
         firmware_qstr_idents = set(qstrutil.static_qstr_list_ident)
 
     # Create initial list of global qstrs.